@@ -2,6 +2,7 @@
 
 #include <Graphics/Input.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Graphics/ResourceManager.hpp>
 #include <Math/Camera2D.hpp>
 #include <Graphics/MouseStateTracker.hpp>
@@ -34,8 +35,12 @@ Player::Player() = default;
 
 Player::Player(const glm::vec2& pos)
     : Entity{ pos, AABB{{18, 10, 0}, {36, 43, 0}} }
+    , horizontalAxis{ Input::getAxisHandle("Horizontal") }
+    , verticalAxis{ Input::getAxisHandle("Vertical") }
 {
-    auto idle_sprites = ResourceManager::loadSpriteSheet("assets/Warrior/SpriteSheet/Warrior_SheetnoEffect.png", 64, 44, 0, 0, BlendMode::AlphaBlend);
+    static const SheetHandle warriorSheet = ResourceManager::getSpriteSheetHandle("assets/Warrior/SpriteSheet/Warrior_SheetnoEffect.png", 64, 44, 0, 0, BlendMode::AlphaBlend);
+
+    auto idle_sprites = ResourceManager::get(warriorSheet);
     IdleAnim = SpriteAnim(idle_sprites, 12, { {0, 1, 2, 3, 4, 5} });
     RunAnim = SpriteAnim(idle_sprites, 12, { {6, 7, 8, 9, 10, 11} });
     AttackAnim = SpriteAnim(idle_sprites, 12, { {14, 15, 16, 17, 18, 19, 20, 21, 22} });
@@ -80,31 +85,40 @@ void Player::update(float deltaTime)
     }
 }
 
-void Player::draw(Graphics::Image& image, const Camera2D& camera)
+void Player::submit(Graphics::RenderQueue& queue, const Camera2D& camera) const
+{
+    const SpriteAnim* anim = getCurrentAnim();
+    if (!anim || !anim->getSpriteSheet())
+        return;
+
+    queue.submit(*anim->getSpriteSheet(), { anim->getSpriteId(), camera * transform }, 1, getPosition().y);
+}
+
+void Player::drawDebug(Graphics::Image& image, const Camera2D& camera) const
+{
+    Entity::drawDebug(image, camera);
+
+    auto pos = camera * transform;
+    image.drawText(Font::Default, g_StateString[state], pos[2][0], pos[2][1], Color::Black);
+}
+
+const SpriteAnim* Player::getCurrentAnim() const
 {
     switch (state)
     {
     case State::Idle:
-        image.drawSprite(IdleAnim, camera * transform);
-        break;
+        return &IdleAnim;
     case State::Running:
-        image.drawSprite(RunAnim, camera * transform);
-        break;
+        return &RunAnim;
     case State::Attack:
-        image.drawSprite(AttackAnim, camera * transform);
-        break;
+        return &AttackAnim;
     case State::Dash:
-        image.drawSprite(DashAnim, camera * transform);
-        break;
+        return &DashAnim;
     case State::Dead:
-        image.drawSprite(DieAnim, camera * transform);
-        break;
+        return &DieAnim;
     }
-#if _DEBUG
-    image.drawAABB(camera * getAABB(), Color::Yellow, {}, FillMode::WireFrame);
-    auto pos = camera * transform;
-    image.drawText(Font::Default, g_StateString[state], pos[2][0], pos[2][1], Color::Black);
-#endif
+
+    return nullptr;
 }
 
 
@@ -113,8 +127,8 @@ void Player::doMovement(float deltaTime)
     auto initialPos = transform.getPosition();
     auto newPos = initialPos;
 
-    newPos.x += Input::getAxis("Horizontal") * speed * deltaTime;
-    newPos.y -= Input::getAxis("Vertical") * speed * deltaTime;
+    newPos.x += Input::getAxis(horizontalAxis) * speed * deltaTime;
+    newPos.y -= Input::getAxis(verticalAxis) * speed * deltaTime;
 
     velocity = (newPos - initialPos) / deltaTime;
 
@@ -126,8 +140,8 @@ void Player::doDashMovement(float deltaTime)
     auto initialPos = transform.getPosition();
     auto newPos = initialPos;
     
-    newPos.x += Input::getAxis("Horizontal") * speed * 2 * deltaTime;
-    newPos.y -= Input::getAxis("Vertical") * speed * 2 * deltaTime;
+    newPos.x += Input::getAxis(horizontalAxis) * speed * 2 * deltaTime;
+    newPos.y -= Input::getAxis(verticalAxis) * speed * 2 * deltaTime;
 
     velocity = (newPos - initialPos) / deltaTime ;
 
@@ -2,6 +2,7 @@
 
 #include <Graphics/Input.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Graphics/ResourceManager.hpp>
 #include <Math/Camera2D.hpp>
 
@@ -26,10 +27,16 @@ Enemy::Enemy() = default;
 Enemy::Enemy(const glm::vec2& pos)
     : Entity{ pos, { {8, 16, 0}, {24, 38, 0} } }
 {
-    auto idle_sprites = ResourceManager::loadSpriteSheet("assets/Spirit Boxer/Idle.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
-    auto run_sprites = ResourceManager::loadSpriteSheet("assets/Spirit Boxer/Run.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
-    auto attack_sprites = ResourceManager::loadSpriteSheet("assets/Spirit Boxer/attack 1.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
-    auto death_sprites = ResourceManager::loadSpriteSheet("assets/Spirit Boxer/Damaged & Death.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
+    // The sprite sheets are shared by all enemies, so the paths are only looked up once.
+    static const SheetHandle idleSheet = ResourceManager::getSpriteSheetHandle("assets/Spirit Boxer/Idle.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
+    static const SheetHandle runSheet = ResourceManager::getSpriteSheetHandle("assets/Spirit Boxer/Run.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
+    static const SheetHandle attackSheet = ResourceManager::getSpriteSheetHandle("assets/Spirit Boxer/attack 1.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
+    static const SheetHandle deathSheet = ResourceManager::getSpriteSheetHandle("assets/Spirit Boxer/Damaged & Death.png", 137, 44, 0, 0, BlendMode::AlphaBlend);
+
+    auto idle_sprites = ResourceManager::get(idleSheet);
+    auto run_sprites = ResourceManager::get(runSheet);
+    auto attack_sprites = ResourceManager::get(attackSheet);
+    auto death_sprites = ResourceManager::get(deathSheet);
     idleAnim = SpriteAnim{ idle_sprites, 6 };
     runAnim = SpriteAnim{ run_sprites, 6 };
     attackAnim = SpriteAnim{ attack_sprites, 6 };
@@ -72,29 +79,40 @@ void Enemy::update(float deltaTime)
 }
 
 
-void Enemy::draw(Graphics::Image& image, const Math::Camera2D& camera)
+void Enemy::submit(Graphics::RenderQueue& queue, const Math::Camera2D& camera) const
+{
+    const SpriteAnim* anim = getCurrentAnim();
+    if (!anim || !anim->getSpriteSheet())
+        return;
+
+    queue.submit(*anim->getSpriteSheet(), { anim->getSpriteId(), camera * transform }, 1, getPosition().y);
+}
+
+void Enemy::drawDebug(Graphics::Image& image, const Math::Camera2D& camera) const
+{
+    Entity::drawDebug(image, camera);
+
+    auto pos = camera * transform;
+    image.drawText(Font::Default, g_StateString[state], pos[2][0], pos[2][1], Color::Black);
+    if(target)
+        image.drawCircle(Math::Circle(camera.transformPoint(target->getPosition()), 5), Color::Red);
+}
+
+const SpriteAnim* Enemy::getCurrentAnim() const
 {
     switch (state)
     {
     case State::Idle:
-        image.drawSprite(idleAnim, camera * transform);
-        break;
+        return &idleAnim;
     case State::Running:
-        image.drawSprite(runAnim, camera * transform);
-        break;
+        return &runAnim;
     case State::Attack:
-        image.drawSprite(attackAnim, camera * transform);
-        break;
+        return &attackAnim;
     case State::Dead:
-        image.drawSprite(deathAnim, camera * transform);
+        return &deathAnim;
     }
-#if _DEBUG
-    image.drawAABB(camera * getAABB(), Color::Yellow, {}, FillMode::WireFrame);
-    auto pos = camera * transform;
-    image.drawText(Font::Default, g_StateString[state], pos[2][0], pos[2][1], Color::Black);
-    if(target)
-        image.drawCircle(Math::Circle(camera.transformPoint(target->getPosition()), 5), Color::Red);
-#endif
+
+    return nullptr;
 }
 
 void Enemy::setTarget(Entity* target)
@@ -41,12 +41,16 @@ public:
 	void doDie(float deltaTime);
 
 	void update(float deltaTime) override;
-	void draw(Graphics::Image& image, const Math::Camera2D& camera) override;
+	void submit(Graphics::RenderQueue& queue, const Math::Camera2D& camera) const override;
+	void drawDebug(Graphics::Image& image, const Math::Camera2D& camera) const override;
 	void setTarget(Entity* target);
 
 private:
 	void setState(State newState);
 
+	// Get the animation for the current state.
+	const Graphics::SpriteAnim* getCurrentAnim() const;
+
 	Entity* target = nullptr;
 
 	State state = State::None;
@@ -1,35 +1,55 @@
-#pragma once
-
-#include "Character.hpp"
-
-#include <Graphics/Image.hpp>
-#include <Math/AABB.hpp>
-#include <Math/Transform2D.hpp>
-#include <Math/Camera2D.hpp>
-
-#include <vector>
-
-class Entity
-{
-public:
-    virtual ~Entity() = default;
-
-    virtual void update(float deltaTime) = 0;
-    virtual void draw(Graphics::Image& image, const Math::Camera2D& camera) = 0;
-
-    void setPosition(const glm::vec2& pos);
-    const glm::vec2& getPosition() const;
-
-    void translate(const glm::vec2& t);
-
-    const Math::AABB getAABB() const;
-
-    virtual bool collides(const Entity& entity) const;
-
-protected:
-    Entity() = default;
-    Entity(const glm::vec2& pos, const Math::AABB& aabb);
-
-    Math::AABB aabb;
-    Math::Transform2D transform;
+#pragma once
+
+#include "Character.hpp"
+
+#include <Graphics/Image.hpp>
+#include <Math/AABB.hpp>
+#include <Math/Transform2D.hpp>
+#include <Math/Camera2D.hpp>
+
+#include <vector>
+
+namespace Graphics
+{
+    class RenderQueue;
+}
+
+class Entity
+{
+public:
+    virtual ~Entity() = default;
+
+    virtual void update(float deltaTime) = 0;
+
+    /// <summary>
+    /// Add the entity's sprite to the render queue.
+    /// The entity is sorted by the y-coordinate of its position (its feet).
+    /// </summary>
+    /// <param name="queue">The render queue to add the entity's sprite to.</param>
+    /// <param name="camera">The camera used to transform the entity to screen space.</param>
+    virtual void submit(Graphics::RenderQueue& queue, const Math::Camera2D& camera) const = 0;
+
+    /// <summary>
+    /// Draw debug information (the entity's AABB) on top of the rendered scene.
+    /// Call this after the render queue is drawn.
+    /// </summary>
+    /// <param name="image">The image to draw the debug information to.</param>
+    /// <param name="camera">The camera used to transform the entity to screen space.</param>
+    virtual void drawDebug(Graphics::Image& image, const Math::Camera2D& camera) const;
+
+    void setPosition(const glm::vec2& pos);
+    const glm::vec2& getPosition() const;
+
+    void translate(const glm::vec2& t);
+
+    const Math::AABB getAABB() const;
+
+    virtual bool collides(const Entity& entity) const;
+
+protected:
+    Entity() = default;
+    Entity(const glm::vec2& pos, const Math::AABB& aabb);
+
+    Math::AABB aabb;
+    Math::Transform2D transform;
 };
\ No newline at end of file
@@ -37,6 +37,18 @@ TileMap ParseTileMap(const ldtk::Layer& layer, const std::filesystem::path& proj
 	return tileMap;
 }
 
+TileMap LoadTileMap(const LevelFile& file, const LevelFile::Layer& layer)
+{
+	const auto& tileSet = file.getTileset(layer);
+
+	auto spriteSheet = ResourceManager::loadSpriteSheet(file.getDirectory() / file.getString(tileSet.path), tileSet.tileSize, tileSet.tileSize, tileSet.padding, tileSet.spacing, BlendMode::AlphaBlend);
+	auto tileMap = TileMap(spriteSheet, layer.columns, layer.rows);
+
+	tileMap.setSpriteGrid(file.getTiles(layer));
+
+	return tileMap;
+}
+
 Level::Level(const ldtk::Project& project, const ldtk::World& world, const ldtk::Level& level)
 	: world{ &world }
 	, level{ &level }
@@ -62,6 +74,7 @@ Level::Level(const ldtk::Project& project, const ldtk::World& world, const ldtk:
 		colliders.push_back(collider);
 	}
 
+	buildColliderTree();
 
 
 	// Parse the level tile map.
@@ -85,6 +98,30 @@ Level::Level(const ldtk::Project& project, const ldtk::World& world, const ldtk:
 
 }
 
+Level::Level(const LevelFile& file, const LevelFile::Level& level)
+	: levelName{ file.getString(level.name) }
+{
+	const auto fileColliders = file.getColliders(level);
+	colliders.reserve(fileColliders.size());
+
+	for (const auto& c : fileColliders)
+	{
+		colliders.push_back(Collider{
+			.type = static_cast<ColliderType>(c.type),
+			.aabb = AABB { { c.minX, c.minY, 0.0f }, { c.maxX, c.maxY, 0.0f } },
+			.isOneWay = c.isOneWay != 0u,
+		});
+	}
+
+	buildColliderTree();
+
+	if (const auto* tilesLayer = file.findLayer(level, "Tiles"))
+		tileMap = LoadTileMap(file, *tilesLayer);
+
+	if (const auto* grassBladesLayer = file.findLayer(level, "Grassblades"))
+		treeMap = LoadTileMap(file, *grassBladesLayer);
+}
+
 void Level::update(float deltaTime)
 {
 	updateCollisions(deltaTime);
@@ -106,8 +143,18 @@ void Level::updateCollisions(float deltaTime)
 
 	const float padding = 3.0f;
 
-	for (auto& collider : colliders)
+	// The edges are inset by padding along their length, so they lie within their collider's bounds grown by padding on
+	// every side (they can stick out of a collider that is narrower or shorter than 2 * padding). Only the colliders whose
+	// bounds overlap the player's box grown by the same amount can have an edge that touches the player.
+	nearbyColliders.clear();
+	colliderTree.query(AABB2{ playerAABB }.inflated(padding), [this](int32_t proxy) {
+		nearbyColliders.push_back(static_cast<uint32_t>(proxy));
+		return true;
+	});
+
+	for (uint32_t i : nearbyColliders)
 	{
+		const Collider& collider = colliders[i];
 		AABB colliderAABB = collider.aabb;
 
 		// if idle or running
@@ -148,6 +195,20 @@ void Level::updateCollisions(float deltaTime)
 	}
 }
 
+void Level::buildColliderTree()
+{
+	std::vector<AABB2> bounds;
+	bounds.reserve(colliders.size());
+
+	for (const auto& collider : colliders)
+	{
+		bounds.push_back(AABB2{ collider.aabb });
+	}
+
+	// The colliders don't move, so the tree is built once (top-down) instead of inserting them one at a time.
+	colliderTree.build(bounds);
+}
+
 void Level::updateEffects(float deltaTime)
 {
 	for (auto iter = effects.begin(); iter != effects.end(); )
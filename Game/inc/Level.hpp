@@ -4,11 +4,13 @@
 
 #include "Box.hpp"
 #include "Effect.hpp"
+#include "LevelFile.hpp"
 #include "Pickup.hpp"
 #include "Player.hpp"
 
 #include <Audio/Sound.hpp>
 #include <Math/AABB.hpp>
+#include <Math/AABBTree.hpp>
 
 #include <Graphics/Image.hpp>
 #include <Graphics/TileMap.hpp>
@@ -39,6 +41,10 @@ public:
 	Level() = default;
 	Level(const ldtk::Project& project, const ldtk::World& world, const ldtk::Level& level);
 
+	// Load a level from a compiled level file (see tools/LevelCompiler).
+	// No JSON is parsed, and each tile map is copied from the file in one go.
+	Level(const LevelFile& file, const LevelFile::Level& level);
+
 	void update(float deltaTime);
 
 	// Reset level.
@@ -56,6 +62,9 @@ private:
 	void updateEffects(float deltaTime);
 	void updateBoxes(float deltaTime);
 
+	// Rebuild the collider tree after the colliders change.
+	void buildColliderTree();
+
 	const ldtk::World* world = nullptr;
 	const ldtk::Level* level = nullptr;
 
@@ -64,6 +73,13 @@ private:
 	// Level colliders.
 	std::vector<Collider> colliders;
 
+	// The bounding volume hierarchy of the colliders, used to find the colliders near the player.
+	// The proxy of each collider is its index in colliders.
+	Math::AABBTree colliderTree;
+
+	// The colliders that overlap the player (reused every frame).
+	std::vector<uint32_t> nearbyColliders;
+
 	// Currently playing effects.
 	std::vector<Effect> effects;
 
@@ -0,0 +1,123 @@
+#include "LevelFile.hpp"
+
+#include <Graphics/File.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+template<typename T>
+std::span<const T> getRecords(std::span<const std::byte> data, uint64_t offset, uint32_t count) noexcept
+{
+	if (offset % alignof(T) != 0 || offset > data.size() || static_cast<uint64_t>(count) * sizeof(T) > data.size() - offset)
+		return {};
+
+	return { reinterpret_cast<const T*>(data.data() + offset), count };
+}
+}
+
+LevelFile::LevelFile(const std::filesystem::path& path)
+	: directory{ path.parent_path() }
+{
+	try
+	{
+		file = Graphics::File::map(path);
+		data = file.getData();
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "ERROR: Could not load level file: " << e.what() << std::endl;
+		return;
+	}
+
+	Header header{};
+	if (data.size() >= sizeof(Header))
+		std::memcpy(&header, data.data(), sizeof(Header));
+
+	if (header.magic != Magic || header.version != Version)
+	{
+		std::cerr << "ERROR: Invalid level file (or unsupported version): " << path.string() << std::endl;
+		*this = LevelFile{};
+		return;
+	}
+
+	levels = getRecords<Level>(data, header.levelsOffset, header.numLevels);
+	tilesets = getRecords<Tileset>(data, header.tilesetsOffset, header.numTilesets);
+	layers = getRecords<Layer>(data, header.layersOffset, header.numLayers);
+	colliders = getRecords<Collider>(data, header.collidersOffset, header.numColliders);
+	entities = getRecords<Entity>(data, header.entitiesOffset, header.numEntities);
+
+	const auto chars = getRecords<char>(data, header.stringsOffset, header.stringsSize);
+	strings = { chars.data(), chars.size() };
+
+	const bool complete = levels.size() == header.numLevels && tilesets.size() == header.numTilesets && layers.size() == header.numLayers &&
+	                      colliders.size() == header.numColliders && entities.size() == header.numEntities && strings.size() == header.stringsSize;
+
+	if (!complete || !validate())
+	{
+		std::cerr << "ERROR: Corrupt level file: " << path.string() << std::endl;
+		*this = LevelFile{};
+	}
+}
+
+bool LevelFile::validate() const noexcept
+{
+	auto validString = [this](const StringRef& str) {
+		return static_cast<uint64_t>(str.offset) + str.length <= strings.size();
+	};
+
+	auto validRange = [](uint32_t first, uint32_t count, size_t size) {
+		return static_cast<uint64_t>(first) + count <= size;
+	};
+
+	for (const auto& tileset : tilesets)
+	{
+		if (!validString(tileset.path) || tileset.tileSize == 0u)
+			return false;
+	}
+
+	for (const auto& layer : layers)
+	{
+		const uint64_t tilesSize = static_cast<uint64_t>(layer.columns) * layer.rows * sizeof(int32_t);
+		if (!validString(layer.name) || layer.tileset >= tilesets.size() || layer.tilesOffset % alignof(int32_t) != 0 ||
+		    layer.tilesOffset > data.size() || tilesSize > data.size() - layer.tilesOffset)
+			return false;
+	}
+
+	for (const auto& entity : entities)
+	{
+		if (!validString(entity.name))
+			return false;
+	}
+
+	for (const auto& level : levels)
+	{
+		if (!validString(level.name) || !validRange(level.firstLayer, level.numLayers, layers.size()) ||
+		    !validRange(level.firstCollider, level.numColliders, colliders.size()) || !validRange(level.firstEntity, level.numEntities, entities.size()))
+			return false;
+	}
+
+	return true;
+}
+
+const LevelFile::Level* LevelFile::findLevel(std::string_view name) const noexcept
+{
+	const auto iter = std::ranges::find(levels, name, [this](const Level& level) { return getString(level.name); });
+
+	return iter != levels.end() ? &*iter : nullptr;
+}
+
+const LevelFile::Layer* LevelFile::findLayer(const Level& level, std::string_view name) const noexcept
+{
+	const auto levelLayers = getLayers(level);
+	const auto iter = std::ranges::find(levelLayers, name, [this](const Layer& layer) { return getString(layer.name); });
+
+	return iter != levelLayers.end() ? &*iter : nullptr;
+}
+
+std::span<const int32_t> LevelFile::getTiles(const Layer& layer) const noexcept
+{
+	return { reinterpret_cast<const int32_t*>(data.data() + layer.tilesOffset), static_cast<size_t>(layer.columns) * layer.rows };
+}
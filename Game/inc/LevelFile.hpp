@@ -0,0 +1,196 @@
+#pragma once
+
+#include <Graphics/MappedFile.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/// <summary>
+/// A compiled level file (.lvl) created from an LDtk project by the LevelCompiler tool.
+/// The file is a header followed by flat arrays of fixed-size records, so it can be read (or memory-mapped) and used
+/// in place without any parsing. All offsets are relative to the start of the file and all values are little-endian.
+/// </summary>
+class LevelFile final
+{
+public:
+	static constexpr uint32_t Magic   = 0x4C56454C;  // "LEVL"
+	static constexpr uint32_t Version = 1u;
+
+	// Tile grids and record arrays start on this alignment.
+	static constexpr uint64_t DataAlignment = 16u;
+
+	// A string in the string table (not null-terminated).
+	struct StringRef
+	{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t numLevels;
+		uint32_t numTilesets;
+		uint32_t numLayers;
+		uint32_t numColliders;
+		uint32_t numEntities;
+		uint32_t stringsSize;
+		uint64_t levelsOffset;
+		uint64_t tilesetsOffset;
+		uint64_t layersOffset;
+		uint64_t collidersOffset;
+		uint64_t entitiesOffset;
+		uint64_t stringsOffset;
+	};
+
+	struct Tileset
+	{
+		StringRef path;  // Relative to the directory of the level file.
+		uint32_t  tileSize;
+		uint32_t  padding;
+		uint32_t  spacing;
+	};
+
+	// A level and the range of layers, colliders, and entities that belong to it.
+	struct Level
+	{
+		StringRef name;
+		int32_t   worldX;  // The position of the level in the world (in pixels).
+		int32_t   worldY;
+		uint32_t  width;   // The size of the level (in pixels).
+		uint32_t  height;
+		uint32_t  firstLayer;
+		uint32_t  numLayers;
+		uint32_t  firstCollider;
+		uint32_t  numColliders;
+		uint32_t  firstEntity;
+		uint32_t  numEntities;
+	};
+
+	// A tile layer. The tiles are stored row by row (-1 for an empty cell), ready to be copied into a TileMap.
+	struct Layer
+	{
+		StringRef name;
+		uint32_t  tileset;  // Index into the tileset table.
+		uint32_t  columns;
+		uint32_t  rows;
+		uint32_t  gridSize;
+		uint64_t  tilesOffset;
+	};
+
+	// An axis-aligned collider (in level space, in pixels).
+	struct Collider
+	{
+		float    minX;
+		float    minY;
+		float    maxX;
+		float    maxY;
+		uint32_t type;  // ColliderType
+		uint32_t isOneWay;
+	};
+
+	// An entity spawn point (in level space, in pixels).
+	struct Entity
+	{
+		StringRef name;
+		float     x;
+		float     y;
+		float     width;
+		float     height;
+	};
+
+	LevelFile() = default;
+
+	/// <summary>
+	/// Load a compiled level file.
+	/// The file is memory-mapped and the records are used in place, so the file stays mapped until the LevelFile is destroyed.
+	/// The header and all of the records are validated when the file is loaded, so the accessors don't need to be checked.
+	/// </summary>
+	/// <param name="path">The path to the .lvl file.</param>
+	explicit LevelFile(const std::filesystem::path& path);
+
+	// The record spans point into the mapped file, so the file can be moved but not copied.
+	LevelFile(const LevelFile&) = delete;
+	LevelFile(LevelFile&&) noexcept = default;
+	LevelFile& operator=(const LevelFile&) = delete;
+	LevelFile& operator=(LevelFile&&) noexcept = default;
+
+	/// <summary>
+	/// Check if the file was loaded.
+	/// </summary>
+	explicit operator bool() const noexcept
+	{
+		return !data.empty();
+	}
+
+	/// <summary>
+	/// Get the directory that the file was loaded from (tileset paths are relative to this directory).
+	/// </summary>
+	const std::filesystem::path& getDirectory() const noexcept
+	{
+		return directory;
+	}
+
+	std::span<const Level> getLevels() const noexcept
+	{
+		return levels;
+	}
+
+	/// <summary>
+	/// Find a level by name.
+	/// </summary>
+	/// <returns>The level, or nullptr if there is no level with that name.</returns>
+	const Level* findLevel(std::string_view name) const noexcept;
+
+	const Tileset& getTileset(const Layer& layer) const noexcept
+	{
+		return tilesets[layer.tileset];
+	}
+
+	std::span<const Layer> getLayers(const Level& level) const noexcept
+	{
+		return layers.subspan(level.firstLayer, level.numLayers);
+	}
+
+	/// <summary>
+	/// Find a layer of a level by name.
+	/// </summary>
+	/// <returns>The layer, or nullptr if the level has no layer with that name.</returns>
+	const Layer* findLayer(const Level& level, std::string_view name) const noexcept;
+
+	std::span<const int32_t> getTiles(const Layer& layer) const noexcept;
+
+	std::span<const Collider> getColliders(const Level& level) const noexcept
+	{
+		return colliders.subspan(level.firstCollider, level.numColliders);
+	}
+
+	std::span<const Entity> getEntities(const Level& level) const noexcept
+	{
+		return entities.subspan(level.firstEntity, level.numEntities);
+	}
+
+	std::string_view getString(const StringRef& str) const noexcept
+	{
+		return strings.substr(str.offset, str.length);
+	}
+
+private:
+	bool validate() const noexcept;
+
+	std::filesystem::path      directory;
+	Graphics::MappedFile       file;
+	std::span<const std::byte> data;
+
+	std::span<const Level>    levels;
+	std::span<const Tileset>  tilesets;
+	std::span<const Layer>    layers;
+	std::span<const Collider> colliders;
+	std::span<const Entity>   entities;
+	std::string_view          strings;
+};
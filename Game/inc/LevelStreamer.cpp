@@ -0,0 +1,237 @@
+#include "LevelStreamer.hpp"
+
+#include <Graphics/BlendMode.hpp>
+#include <Graphics/JobPool.hpp>
+#include <Graphics/ResourceManager.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Graphics;
+using namespace Math;
+
+namespace
+{
+// The distance between the camera view and a level (0 if they overlap).
+float distance(const AABB& view, const AABB& bounds) noexcept
+{
+	const float dx = std::max({ bounds.min.x - view.max.x, view.min.x - bounds.max.x, 0.0f });
+	const float dy = std::max({ bounds.min.y - view.max.y, view.min.y - bounds.max.y, 0.0f });
+
+	return std::max(dx, dy);
+}
+
+AABB getView(const Camera2D& camera) noexcept
+{
+	return AABB{ { camera.getLeftEdge(), camera.getTopEdge(), 0.0f }, { camera.getRightEdge(), camera.getBottomEdge(), 0.0f } };
+}
+
+// Gather the tile grids and transform the colliders of a level to world space (runs on the job pool).
+// The tile grids are used in place, so the level data keeps the level file mapped.
+std::shared_ptr<LevelStreamer::LevelData> buildLevel(std::shared_ptr<const LevelFile> levelFile, const LevelFile::Level& level, const AABB& bounds)
+{
+	const LevelFile& file = *levelFile;
+
+	auto data = std::make_shared<LevelStreamer::LevelData>();
+	data->file = std::move(levelFile);
+	data->name = file.getString(level.name);
+	data->bounds = bounds;
+
+	// LDtk stores the top layer first.
+	const auto layers = file.getLayers(level);
+	data->layers.reserve(layers.size());
+	for (auto iter = layers.rbegin(); iter != layers.rend(); ++iter)
+	{
+		const auto tiles = file.getTiles(*iter);
+
+		auto& layer = data->layers.emplace_back();
+		layer.columns = iter->columns;
+		layer.rows = iter->rows;
+		layer.gridSize = iter->gridSize;
+		layer.tiles = tiles;
+
+		data->memoryUsage += tiles.size_bytes();
+	}
+
+	const auto colliders = file.getColliders(level);
+	data->colliders.reserve(colliders.size());
+	for (const auto& c : colliders)
+	{
+		data->colliders.push_back(Collider{
+			.type = static_cast<ColliderType>(c.type),
+			.aabb = AABB{ { bounds.min.x + c.minX, bounds.min.y + c.minY, 0.0f }, { bounds.min.x + c.maxX, bounds.min.y + c.maxY, 0.0f } },
+			.isOneWay = c.isOneWay != 0u,
+		});
+	}
+
+	data->memoryUsage += sizeof(LevelStreamer::LevelData) + data->colliders.size() * sizeof(Collider);
+
+	return data;
+}
+}
+
+LevelStreamer::LevelStreamer(std::shared_ptr<const LevelFile> levelFile, std::string_view originLevel)
+	: file{ std::move(levelFile) }
+{
+	if (!file || file->getLevels().empty())
+		return;
+
+	const auto* origin = originLevel.empty() ? &file->getLevels().front() : file->findLevel(originLevel);
+	if (!origin)
+		origin = &file->getLevels().front();
+
+	const auto fileLevels = file->getLevels();
+	levels.resize(fileLevels.size());
+
+	for (uint32_t i = 0; i < fileLevels.size(); ++i)
+	{
+		const auto& level = fileLevels[i];
+		const float x = static_cast<float>(level.worldX - origin->worldX);
+		const float y = static_cast<float>(level.worldY - origin->worldY);
+
+		levels[i].index = i;
+		levels[i].bounds = AABB{ { x, y, 0.0f }, { x + static_cast<float>(level.width), y + static_cast<float>(level.height), 0.0f } };
+	}
+}
+
+size_t LevelStreamer::getNumPending() const noexcept
+{
+	return static_cast<size_t>(std::ranges::count_if(levels, [](const StreamedLevel& level) { return level.pending.valid(); }));
+}
+
+void LevelStreamer::load(StreamedLevel& level)
+{
+	const auto& info = file->getLevels()[level.index];
+
+	// The sprite sheets are decoded by the resource manager (and shared with other levels that use the same tilesets).
+	// Layers are stored from bottom to top, the same order that buildLevel uses.
+	const auto layers = file->getLayers(info);
+	level.spriteSheets.clear();
+	for (auto iter = layers.rbegin(); iter != layers.rend(); ++iter)
+	{
+		const auto& tileset = file->getTileset(*iter);
+		level.spriteSheets.push_back(ResourceManager::loadSpriteSheetAsync(file->getDirectory() / file->getString(tileset.path), tileset.tileSize, tileset.tileSize, tileset.padding, tileset.spacing, BlendMode::AlphaBlend));
+	}
+
+	level.pending = JobPool::getShared().submit([levelFile = file, index = level.index, bounds = level.bounds] {
+		return buildLevel(levelFile, levelFile->getLevels()[index], bounds);
+	});
+}
+
+bool LevelStreamer::finishLoading(StreamedLevel& level)
+{
+	if (level.pending.wait_for(std::chrono::seconds{ 0 }) != std::future_status::ready)
+		return false;
+
+	if (!std::ranges::all_of(level.spriteSheets, [](const auto& sheet) { return sheet.isReady(); }))
+		return false;
+
+	auto data = level.pending.get();
+	for (size_t i = 0; i < data->layers.size(); ++i)
+		data->layers[i].spriteSheet = level.spriteSheets[i].get();
+
+	level.spriteSheets.clear();
+
+	levelDataUsage += data->memoryUsage;
+	level.data = std::move(data);
+
+	return true;
+}
+
+void LevelStreamer::update(const Camera2D& camera)
+{
+	if (!file)
+		return;
+
+	const AABB view = getView(camera);
+	bool       changed = false;
+
+	for (auto& level : levels)
+	{
+		if (level.pending.valid())
+		{
+			changed |= finishLoading(level);
+		}
+		else if (!level.data && distance(view, level.bounds) <= loadDistance)
+		{
+			load(level);
+		}
+	}
+
+	// Unload the levels that are farthest away until the streamed levels fit in the budget.
+	if (levelDataUsage > levelDataBudget)
+	{
+		std::vector<StreamedLevel*> distant;
+		for (auto& level : levels)
+		{
+			if (level.data && distance(view, level.bounds) > loadDistance * 2.0f)
+				distant.push_back(&level);
+		}
+
+		std::ranges::sort(distant, std::ranges::greater{}, [&view](const StreamedLevel* level) { return distance(view, level->bounds); });
+
+		for (auto* level : distant)
+		{
+			if (levelDataUsage <= levelDataBudget)
+				break;
+
+			levelDataUsage -= level->data->memoryUsage;
+			level->data.reset();
+			changed = true;
+		}
+	}
+
+	if (changed)
+	{
+		for (const auto& level : levels)
+		{
+			if (level.data)
+				back.push_back(level.data);
+		}
+
+		std::swap(front, back);
+		back.clear();
+	}
+}
+
+void LevelStreamer::draw(Image& image, const Camera2D& camera)
+{
+	const AABB view = getView(camera);
+
+	for (const auto& level : front)
+	{
+		if (distance(view, level->bounds) > 0.0f)
+			continue;
+
+		for (const auto& layer : level->layers)
+		{
+			if (!layer.spriteSheet || layer.gridSize == 0u)
+				continue;
+
+			const auto  numSprites = static_cast<int>(layer.spriteSheet->getNumSprites());
+			const float gridSize = static_cast<float>(layer.gridSize);
+
+			// Only the tiles that overlap the view.
+			const auto firstColumn = static_cast<uint32_t>(std::max(std::floor((view.min.x - level->bounds.min.x) / gridSize), 0.0f));
+			const auto firstRow = static_cast<uint32_t>(std::max(std::floor((view.min.y - level->bounds.min.y) / gridSize), 0.0f));
+			const auto lastColumn = static_cast<uint32_t>(std::clamp(std::ceil((view.max.x - level->bounds.min.x) / gridSize), 0.0f, static_cast<float>(layer.columns)));
+			const auto lastRow = static_cast<uint32_t>(std::clamp(std::ceil((view.max.y - level->bounds.min.y) / gridSize), 0.0f, static_cast<float>(layer.rows)));
+
+			instances.clear();
+			for (uint32_t row = firstRow; row < lastRow; ++row)
+			{
+				for (uint32_t column = firstColumn; column < lastColumn; ++column)
+				{
+					const int spriteId = layer.tiles[static_cast<size_t>(row) * layer.columns + column];
+					if (spriteId < 0 || spriteId >= numSprites)
+						continue;
+
+					const glm::vec2 position{ level->bounds.min.x + static_cast<float>(column) * gridSize, level->bounds.min.y + static_cast<float>(row) * gridSize };
+					instances.emplace_back(static_cast<uint32_t>(spriteId), camera.transformPoint(position));
+				}
+			}
+
+			image.drawSprites(*layer.spriteSheet, instances);
+		}
+	}
+}
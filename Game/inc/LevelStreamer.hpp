@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Level.hpp"
+#include "LevelFile.hpp"
+
+#include <Graphics/Image.hpp>
+#include <Graphics/LoadHandle.hpp>
+#include <Graphics/SpriteInstance.hpp>
+#include <Graphics/SpriteSheet.hpp>
+#include <Math/AABB.hpp>
+#include <Math/Camera2D.hpp>
+
+#include <future>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// <summary>
+/// Streams the levels of a compiled LDtk world (see LevelFile) in and out around the camera.
+/// Levels that come within the load distance of the camera are loaded in the background (the tile grids and colliders
+/// on the job pool, and the sprite sheets by the resource manager). A level only becomes visible once all of its data
+/// is ready, so streaming never stalls a frame. Levels that are far away are unloaded when the level data (the tile
+/// grids and colliders) uses more memory than the budget. The sprite sheets are shared between levels and cached by the
+/// resource manager, so their memory is limited by the resource manager's image budget instead.
+/// </summary>
+class LevelStreamer final
+{
+public:
+	// A tile layer of a streamed level.
+	struct TileLayer
+	{
+		std::shared_ptr<Graphics::SpriteSheet> spriteSheet;
+		uint32_t                               columns = 0u;
+		uint32_t                               rows = 0u;
+		uint32_t                               gridSize = 0u;
+		std::span<const int32_t>               tiles;  // Points into the mapped level file.
+	};
+
+	// The data of a level that has been streamed in.
+	// Level data is immutable once it is visible, so a frame can keep using it while the streamer moves on.
+	struct LevelData
+	{
+		std::shared_ptr<const LevelFile> file;       // Keeps the level file (and the tiles that point into it) mapped.
+		std::string                      name;
+		Math::AABB                       bounds;     // In world space.
+		std::vector<TileLayer>           layers;     // From bottom to top.
+		std::vector<Collider>            colliders;  // In world space.
+		size_t                           memoryUsage = 0u;  // The memory used by the tile grids (paged in from the level file) and colliders (not the sprite sheets).
+	};
+
+	LevelStreamer() = default;
+
+	/// <summary>
+	/// Stream the levels of a compiled level file.
+	/// </summary>
+	/// <param name="file">The level file. It is shared with the background jobs that load the levels.</param>
+	/// <param name="originLevel">(optional) The level that is placed at the origin of world space. Default: the first level in the file.</param>
+	explicit LevelStreamer(std::shared_ptr<const LevelFile> file, std::string_view originLevel = {});
+
+	/// <summary>
+	/// Set how far outside of the camera view levels are loaded (in pixels). Default: 256.
+	/// Levels are not unloaded until they are twice as far away.
+	/// </summary>
+	void setLoadDistance(float distance) noexcept
+	{
+		loadDistance = distance;
+	}
+
+	/// <summary>
+	/// Set the amount of memory that the level data (tile grids and colliders) may use before distant levels are
+	/// unloaded. Default: 16 MiB. The sprite sheets are not included (see ResourceManager::setBudget).
+	/// </summary>
+	void setLevelDataBudget(size_t bytes) noexcept
+	{
+		levelDataBudget = bytes;
+	}
+
+	/// <summary>
+	/// Start loading the levels that are near the camera, make the levels that finished loading visible, and unload
+	/// distant levels. Call this once per frame before the levels are drawn.
+	/// </summary>
+	/// <param name="camera">The camera that the levels are streamed around.</param>
+	void update(const Math::Camera2D& camera);
+
+	/// <summary>
+	/// Draw the tiles of the visible levels that overlap the camera view.
+	/// </summary>
+	void draw(Graphics::Image& image, const Math::Camera2D& camera);
+
+	/// <summary>
+	/// Get the levels that are visible this frame.
+	/// The span is only valid until the next call to update. Copy the pointers to keep using the levels after that.
+	/// </summary>
+	std::span<const std::shared_ptr<const LevelData>> getLevels() const noexcept
+	{
+		return front;
+	}
+
+	/// <summary>
+	/// Get the number of levels that are currently being loaded.
+	/// </summary>
+	size_t getNumPending() const noexcept;
+
+	/// <summary>
+	/// Get the amount of memory used by the level data (tile grids and colliders) of the streamed levels (in bytes).
+	/// The sprite sheets are not included, since they are shared with other levels and cached by the resource manager.
+	/// </summary>
+	size_t getLevelDataUsage() const noexcept
+	{
+		return levelDataUsage;
+	}
+
+private:
+	struct StreamedLevel
+	{
+		uint32_t                                                 index = 0u;  // The index of the level in the level file.
+		Math::AABB                                               bounds;      // In world space.
+		std::shared_ptr<const LevelData>                         data;
+		std::future<std::shared_ptr<LevelData>>                  pending;
+		std::vector<Graphics::LoadHandle<Graphics::SpriteSheet>> spriteSheets;  // One for each layer (bottom to top).
+	};
+
+	void load(StreamedLevel& level);
+	bool finishLoading(StreamedLevel& level);
+
+	std::shared_ptr<const LevelFile> file;
+	std::vector<StreamedLevel>       levels;
+
+	// The visible levels are double-buffered: the back buffer is rebuilt and swapped when levels are streamed in or out.
+	// The back buffer is cleared after the swap, so it doesn't keep unloaded levels alive.
+	std::vector<std::shared_ptr<const LevelData>> front;
+	std::vector<std::shared_ptr<const LevelData>> back;
+
+	std::vector<Graphics::SpriteInstance> instances;  // Reused by draw.
+
+	float  loadDistance = 256.0f;
+	size_t levelDataBudget = 16ull << 20;
+	size_t levelDataUsage = 0u;
+};
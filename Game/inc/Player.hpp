@@ -3,6 +3,7 @@
 #include "Entity.hpp"
 #include "Character.hpp"
 
+#include <Graphics/Input.hpp>
 #include <Graphics/SpriteAnim.hpp>
 #include <Graphics/SpriteSheet.hpp>
 #include <Graphics/Config.hpp>
@@ -47,16 +48,24 @@ public:
 	void setCharacter(size_t characterId);
 
 	virtual void update(float deltaTime) override;
-	virtual void draw(Graphics::Image& image, const Math::Camera2D& camera) override;
+	virtual void submit(Graphics::RenderQueue& queue, const Math::Camera2D& camera) const override;
+	virtual void drawDebug(Graphics::Image& image, const Math::Camera2D& camera) const override;
 	
 
 
 private:
 	void setState(State newState);
 
+	// Get the animation for the current state.
+	const Graphics::SpriteAnim* getCurrentAnim() const;
+
 	glm::vec2 velocity{ 0 };
 	float speed{ 60.0f };
 
+	// The input actions are looked up once and queried by handle every frame.
+	Graphics::AxisHandle horizontalAxis;
+	Graphics::AxisHandle verticalAxis;
+
 	State state = State::None;
 	Graphics::SpriteAnim IdleAnim;
 	Graphics::SpriteAnim RunAnim;
@@ -3,14 +3,21 @@
 #include <LDtkLoader/Project.hpp>
 
 #include <Level.hpp>
+#include <LevelStreamer.hpp>
 #include <Graphics/Window.hpp>
 #include <Graphics/Image.hpp>
+#include <Graphics/ImageWriter.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Graphics/SpriteSheet.hpp>
 #include <Graphics/SpriteAnim.hpp>
 #include <Graphics/Timer.hpp>
 #include <Graphics/Font.hpp>
+#include <Graphics/InputLatency.hpp>
+#include <Graphics/File.hpp>
+#include <Graphics/MappedFile.hpp>
 #include <Graphics/Color.hpp>
+#include <Graphics/RenderQueue.hpp>
+#include <Graphics/TextLayout.hpp>
 #include <Graphics/ResourceManager.hpp>
 #include <Graphics/Vertex.hpp>
 #include <Graphics/Keyboard.hpp>
@@ -25,7 +32,10 @@
 #include <fmt/core.h>
 #include <glm/vec2.hpp>
 
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
+#include <string_view>
 
 using namespace Graphics;
 using namespace Audio;
@@ -37,6 +47,8 @@ TileMap grassTiles;
 Sprite background;
 Camera2D camera;
 Level level;
+LevelStreamer streamer;
+RenderQueue renderQueue;
 
 const int SCREEN_WIDTH = 800;
 const int SCREEN_HEIGHT = 600;
@@ -51,10 +63,38 @@ void InitGame()
 	camera.setPosition(player.getPosition());
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+	// --record <file> records the input of the session, --replay <file> plays a recorded session back (and exits at the end of the recording).
+	// --fixed-dt <seconds> updates the game with a fixed time step (which is recorded, so replays use it too).
+	// --headless replays a recording without creating a window, presenting frames, or playing audio.
+	std::filesystem::path recordFile;
+	std::filesystem::path replayFile;
+	double                fixedDeltaTime = 0.0;
+	bool                  headless = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg{ argv[i] };
+		if (arg == "--headless")
+			headless = true;
+		else if (arg == "--record" && i + 1 < argc)
+			recordFile = argv[++i];
+		else if (arg == "--replay" && i + 1 < argc)
+			replayFile = argv[++i];
+		else if (arg == "--fixed-dt" && i + 1 < argc)
+			fixedDeltaTime = std::strtod(argv[++i], nullptr);
+	}
+
+	if (headless && replayFile.empty())
+	{
+		std::cerr << "--headless requires --replay <file>" << std::endl;
+		return 1;
+	}
+
+	Input::setFixedFrameTime(fixedDeltaTime);
+
 	// Input to go to reload the current map.
-	Input::mapButton("Reload", [](std::span<const GamePadStateTracker> gamePadStates, const KeyboardStateTracker& keyboardState, const MouseStateTracker& mouseState) {
+	const ButtonHandle reloadButton = Input::mapButton("Reload", [](std::span<const GamePadStateTracker> gamePadStates, const KeyboardStateTracker& keyboardState, const MouseStateTracker& mouseState) {
 		bool b = false;
 
 		for (auto& gamePadState : gamePadStates)
@@ -67,13 +107,47 @@ int main()
 
 		return b || enter || r;
 		});
+
+	// The debug toggles are input actions (not window events), so they are recorded and replayed with the rest of the input.
+	// F3 draws the streamed level tiles instead of the background image.
+	const ButtonHandle streamedWorldButton = Input::mapButtonDown("ToggleStreamedWorld", [](std::span<const GamePadStateTracker>, const KeyboardStateTracker& keyboardState, const MouseStateTracker&) {
+		return keyboardState.isKeyPressed(KeyCode::F3);
+		});
+	// F4 shows the input-to-present latency.
+	const ButtonHandle latencyButton = Input::mapButtonDown("ToggleLatency", [](std::span<const GamePadStateTracker>, const KeyboardStateTracker& keyboardState, const MouseStateTracker&) {
+		return keyboardState.isKeyPressed(KeyCode::F4);
+		});
 	
 
+	// Use the pre-decoded assets from the asset pack (see assets/assets.manifest) if it has been built.
+	if (std::filesystem::exists("assets.pak"))
+	{
+		ResourceManager::mountPack("assets.pak");
+	}
+
+	// Evict images that are no longer used once they take up more than 256 MiB.
+	ResourceManager::setBudget(ResourceCategory::Image, 256ull << 20);
+
+	// Decode the textures on the job pool while the window is created and the level is loaded.
+	const std::filesystem::path textures[] = {
+		"assets/Map.png",
+		"assets/Warrior/SpriteSheet/Warrior_SheetnoEffect.png",
+		"assets/Spirit Boxer/Idle.png",
+		"assets/Spirit Boxer/Run.png",
+		"assets/Spirit Boxer/attack 1.png",
+		"assets/Spirit Boxer/Damaged & Death.png",
+	};
+	ResourceManager::prefetch(textures);
+
 	image.resize(SCREEN_WIDTH, SCREEN_HEIGHT);
 	
-	window.create(L"Mist", SCREEN_WIDTH, SCREEN_HEIGHT);
-	window.show();
-	window.setFullscreen(true);
+	if (!headless)
+	{
+		// Receive the window's messages on a dedicated input thread so input is not delayed by long frames.
+		window.create(L"Mist", SCREEN_WIDTH, SCREEN_HEIGHT, true);
+		window.show();
+		window.setFullscreen(true);
+	}
 	
 	
 	player = Player{ { SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2 } };
@@ -82,21 +156,43 @@ int main()
 	// Load tilemap.
 	auto backgroundMap = ResourceManager::loadImage("assets/Map.png");
 	background = Sprite{ backgroundMap };
+	ResourceManager::pin(backgroundMap);
 
+	// Load the compiled level (see tools/LevelCompiler) if it exists, otherwise parse the LDtk project.
+	Timer loadTimer;
 	ldtk::Project project;
-	project.loadFromFile("assets/Map.ldtk");
-	
-	// get a world
-	const auto& world = project.getWorld();
-	// get a level
-	const auto& level1 = world.getLevel("Level_0");
+	if (std::filesystem::exists("assets/Map.lvl"))
+	{
+		auto levelFile = std::make_shared<const LevelFile>("assets/Map.lvl");
+		if (const auto* level1 = levelFile->findLevel("Level_0"))
+			level = Level(*levelFile, *level1);
+
+		// Stream the rest of the world in around the camera.
+		streamer = LevelStreamer(levelFile, "Level_0");
+	}
+	else
+	{
+		// The project (and any external level files) are parsed straight from the memory-mapped files.
+		project.loadFromFile("assets/Map.ldtk", [](const std::string& path) -> std::unique_ptr<std::streambuf> {
+			return std::make_unique<MappedFileBuffer>(File::map(path));
+		});
 
-	level = Level(project, world, level1);
+		// get a world
+		const auto& world = project.getWorld();
+		// get a level
+		const auto& level1 = world.getLevel("Level_0");
+
+		level = Level(project, world, level1);
+	}
+	loadTimer.tick();
+	std::cout << fmt::format("Loaded level in {:.2f} ms", loadTimer.elapsedMilliseconds()) << std::endl;
 	
 
 	Sound music;
 
-	music.loadMusic("audio/Theme.wav");
+	// The music is streamed from the asset pack (or the memory-mapped file if it isn't packed).
+	const FileData theme = ResourceManager::mapFile("audio/Theme.wav", AssetType::Audio);
+	music.loadMusic("audio/Theme.wav", theme.data, theme.storage);
 	music.setVolume(0.25f);
 	
 	
@@ -105,16 +201,45 @@ int main()
 	double      totalTime = 0.0;
 	uint64_t    frameCount = 0ull;
 	std::string fps = "FPS: 0";
+	TextLayout  fpsText{ Font::Default, fps };
+
+	bool drawStreamedWorld = false;
+	bool drawLatency = false;
 
 	InitGame();
 
-	while (window)
+	// Start recording (or replaying) after the game is initialized, so the recorded frames start from the same game state.
+	const bool replaying = !replayFile.empty() && Input::startReplay(replayFile);
+	if (headless && !replaying)
+	{
+		std::cerr << "Failed to open the recording " << replayFile << std::endl;
+		return 1;
+	}
+	if (!recordFile.empty())
+		Input::startRecording(recordFile);
+
+	Timer    replayTimer;
+	uint64_t replayedFrames = 0ull;
+
+	while (headless || window)
 	{
 		// update the input state
 		Input::update();
 
-		player.update(static_cast<float>(timer.elapsedSeconds()));
-		enemy.update(static_cast<float>(timer.elapsedSeconds()));
+		if (replaying && !Input::isReplaying())
+		{
+			std::cout << fmt::format("Input replay finished after {} frames.", replayedFrames) << std::endl;
+			break;
+		}
+
+		if (replaying)
+			++replayedFrames;
+
+		// The game is updated with the frame time of the input, so a replayed session plays out exactly like the recorded session.
+		const float deltaTime = static_cast<float>(Input::getFrameTime());
+
+		player.update(deltaTime);
+		enemy.update(deltaTime);
 
 		// Check collisions
 		static bool isColliding = false;
@@ -156,12 +281,33 @@ int main()
 		//Apply camera correction
 		camera.translate(cameraCorrection);
 
+		streamer.update(camera);
 
-		if (Input::getButton("Reload"))
+
+		if (Input::getButton(reloadButton))
 		{
 			InitGame();
 		}
 
+		if (Input::getButtonDown(streamedWorldButton))
+		{
+			drawStreamedWorld = !drawStreamedWorld;
+		}
+
+		if (Input::getButtonDown(latencyButton))
+		{
+			drawLatency = !drawLatency;
+			InputLatency::reset();
+		}
+
+		enemy.setTarget(&player);
+
+		// Nothing is drawn or played in a headless replay, only the game state is updated.
+		if (headless)
+		{
+			continue;
+		}
+
 		// Render loop.
 
 		image.clear(Color::White);
@@ -172,15 +318,27 @@ int main()
 
 		//level.draw(image, camera);
 
-		image.drawSprite(background, camera);
+		if (drawStreamedWorld)
+			streamer.draw(image, camera);
+		else
+			image.drawSprite(background, camera);
 
-		player.draw(image, camera);
+		// Characters are y-sorted so that the character closest to the bottom of the screen is drawn on top.
+		player.submit(renderQueue, camera);
+		enemy.submit(renderQueue, camera);
 
-		enemy.draw(image, camera);
+		renderQueue.draw(image);
+		renderQueue.clear();
 
-		enemy.setTarget(&player);
+#if _DEBUG
+		player.drawDebug(image, camera);
+		enemy.drawDebug(image, camera);
+#endif
+
+		image.drawText(fpsText, 10, 10, Color::Black);
 
-		image.drawText(Font::Default, fps, 10, 10, Color::Black);
+		if (drawLatency)
+			InputLatency::drawOverlay(image, 10, 30);
 
 		window.present(image);
 
@@ -206,6 +364,19 @@ int main()
 				case KeyCode::F11:
 					window.toggleFullscreen();
 					break;
+				case KeyCode::F2:
+					std::cout << ResourceManager::getResidencyReport() << ResourceManager::getLoadReport();
+					std::cout << fmt::format("Streamed levels: {} visible, {} loading, {:.2f} MiB of level data", streamer.getLevels().size(), streamer.getNumPending(), static_cast<double>(streamer.getLevelDataUsage()) / (1024.0 * 1024.0)) << std::endl;
+					break;
+				case KeyCode::F12:
+				{
+					// Screenshots are encoded on a background thread (QOI is much faster to encode than PNG).
+					static int screenshot = 0;
+					const auto file = fmt::format("screenshot_{:03}.qoi", screenshot++);
+					if (ImageWriter::getShared().save(image, file))
+						std::cout << "Saving " << file << std::endl;
+				}
+				break;
 				}
 			}
 			break;
@@ -219,6 +390,7 @@ int main()
 		if (totalTime > 1.0)
 		{
 			fps = fmt::format("FPS: {:.3f}", static_cast<double>(frameCount) / totalTime);
+			fpsText.setText(fps);
 
 			std::cout << fps << std::endl;
 
@@ -226,6 +398,14 @@ int main()
 			totalTime = 0.0;
 		}
 	}
+	if (replaying)
+	{
+		replayTimer.tick();
+		std::cout << fmt::format("Replayed session in {:.2f} s", replayTimer.totalSeconds()) << std::endl;
+	}
+
+	Input::stopRecording();
+
 	std::cout << "Thanks for playing" << std::endl; 
 
 	return 0;
@@ -1,9 +1,9 @@
-#pragma once
-
-namespace Audio
-{
-    struct Vector
-    {
-        float x, y, z;
-    };
-}
+#pragma once
+
+namespace Audio
+{
+    struct Vector
+    {
+        float x, y, z;
+    };
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "AssetId.hpp"
+
+#include <cstdint>
+
+namespace Graphics
+{
+class Font;
+class Image;
+class ResourceManager;
+class SpriteSheet;
+
+/// <summary>
+/// A typed handle to an asset that has been interned by the ResourceManager.
+/// Handles are cheap to copy and store (for example, in a static variable or a member of a game object). Getting the
+/// resource of a handle does not hash or compare paths, and a handle remains valid if its resource is evicted (the
+/// resource is loaded again the next time it is used).
+/// </summary>
+/// <typeparam name="T">The type of the resource.</typeparam>
+template<typename T>
+class AssetHandle final
+{
+public:
+    constexpr AssetHandle() noexcept = default;
+
+    /// <summary>
+    /// Get the ID of the asset.
+    /// </summary>
+    /// <returns>The asset ID.</returns>
+    constexpr AssetId getId() const noexcept
+    {
+        return id;
+    }
+
+    /// <summary>
+    /// Check if the handle refers to an asset.
+    /// </summary>
+    /// <returns>`true` if the handle was created by the resource manager.</returns>
+    constexpr bool isValid() const noexcept
+    {
+        return index != InvalidIndex;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return isValid();
+    }
+
+    constexpr bool operator==( const AssetHandle& ) const noexcept = default;
+
+private:
+    friend class ResourceManager;
+
+    static constexpr uint32_t InvalidIndex = ~0u;
+
+    constexpr AssetHandle( AssetId id, uint32_t index ) noexcept
+    : id { id }
+    , index { index }
+    {}
+
+    AssetId  id;
+    uint32_t index = InvalidIndex;  // The index of the asset in the resource manager.
+};
+
+using ImageHandle = AssetHandle<Image>;
+using SheetHandle = AssetHandle<SpriteSheet>;
+using FontHandle  = AssetHandle<Font>;
+}  // namespace Graphics
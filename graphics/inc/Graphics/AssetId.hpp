@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+
+namespace Graphics
+{
+/// <summary>
+/// Identifies an asset by the 64-bit FNV-1a hash of its normalized path.
+/// Asset IDs are much cheaper to hash and compare than paths, and they are the same IDs that are used in the index of
+/// an asset pack.
+/// </summary>
+class SR_API AssetId final
+{
+public:
+    static constexpr uint64_t FNVOffsetBasis = 0xcbf29ce484222325ull;
+    static constexpr uint64_t FNVPrime       = 0x100000001b3ull;
+
+    constexpr AssetId() noexcept = default;
+
+    /// <summary>
+    /// Create an asset ID from a hash value.
+    /// </summary>
+    /// <param name="value">The hash value.</param>
+    constexpr explicit AssetId( uint64_t value ) noexcept
+    : value { value }
+    {}
+
+    /// <summary>
+    /// Compute the ID of a path.
+    /// The path is normalized (and uses forward slashes) before it is hashed, so "assets/../assets/Map.png" and
+    /// "assets\Map.png" have the same ID.
+    /// </summary>
+    /// <param name="path">The path to the asset.</param>
+    explicit AssetId( const std::filesystem::path& path )
+    : AssetId { fromNormalizedPath( path.lexically_normal().generic_string() ) }
+    {}
+
+    /// <summary>
+    /// Compute the ID of a path that is already normalized (it uses forward slashes and has no "." or ".." elements).
+    /// This can be evaluated at compile time (see the `_asset` literal).
+    /// </summary>
+    /// <param name="path">The normalized path.</param>
+    /// <returns>The ID of the asset.</returns>
+    static constexpr AssetId fromNormalizedPath( std::string_view path ) noexcept
+    {
+        return AssetId { FNVOffsetBasis }.combine( path );
+    }
+
+    /// <summary>
+    /// Derive a new ID by hashing more data into this ID (for example, the size of a font).
+    /// </summary>
+    /// <param name="data">The data to add to the hash.</param>
+    /// <returns>The derived ID.</returns>
+    constexpr AssetId combine( std::string_view data ) const noexcept
+    {
+        uint64_t hash = value;
+        for ( char c: data )
+        {
+            hash ^= static_cast<unsigned char>( c );
+            hash *= FNVPrime;
+        }
+
+        return AssetId { hash };
+    }
+
+    /// <summary>
+    /// Derive a new ID by hashing more data into this ID (for example, the size of a font).
+    /// </summary>
+    /// <param name="data">The data to add to the hash (hashed in little-endian byte order).</param>
+    /// <returns>The derived ID.</returns>
+    constexpr AssetId combine( uint64_t data ) const noexcept
+    {
+        uint64_t hash = value;
+        for ( int i = 0; i < 8; ++i )
+        {
+            hash ^= ( data >> ( i * 8 ) ) & 0xFFu;
+            hash *= FNVPrime;
+        }
+
+        return AssetId { hash };
+    }
+
+    /// <summary>
+    /// Get the hash value of the ID.
+    /// </summary>
+    /// <returns>The 64-bit hash.</returns>
+    constexpr uint64_t getValue() const noexcept
+    {
+        return value;
+    }
+
+    constexpr auto operator<=>( const AssetId& ) const noexcept = default;
+
+private:
+    uint64_t value = 0u;
+};
+
+namespace Literals
+{
+/// <summary>
+/// Compute the ID of a normalized path at compile time.
+/// For example: `constexpr AssetId map = "assets/Map.png"_asset;`
+/// </summary>
+consteval AssetId operator""_asset( const char* path, size_t length )
+{
+    return AssetId::fromNormalizedPath( { path, length } );
+}
+}  // namespace Literals
+}  // namespace Graphics
+
+// Asset IDs are already hashes.
+template<>
+struct std::hash<Graphics::AssetId>
+{
+    size_t operator()( const Graphics::AssetId& id ) const noexcept
+    {
+        return static_cast<size_t>( id.getValue() );
+    }
+};
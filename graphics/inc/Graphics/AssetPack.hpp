@@ -0,0 +1,236 @@
+#pragma once
+
+#include "AssetId.hpp"
+#include "Config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace Graphics
+{
+class Image;
+class MappedFile;
+
+/// <summary>
+/// The type of an asset in an asset pack.
+/// </summary>
+enum class AssetType : uint32_t
+{
+    Image       = 1,  ///< Pre-swizzled 32-bit pixels that can be used directly by an Image.
+    SpriteSheet = 2,  ///< The slicing parameters of a sprite sheet (see AssetPack::SpriteSheetInfo).
+    Font        = 3,  ///< The contents of a TrueType font file.
+    Audio       = 4,  ///< The contents of an audio file.
+    Data        = 5,  ///< Any other file.
+};
+
+/// <summary>
+/// How the data of an asset is stored in an asset pack.
+/// </summary>
+enum class AssetCompression : uint32_t
+{
+    None = 0,  ///< The data is stored as-is and can be used directly from the memory-mapped pack.
+};
+
+/// <summary>
+/// A single file that contains pre-processed assets and an index to find them.
+/// Asset packs are created by the AssetPacker tool. The pack is memory-mapped when it is opened, so assets don't need
+/// to be read or decoded: images use the pixels in the mapped file directly and are only copied (one page at a time,
+/// by the OS) if they are modified.
+/// Assets are identified by the hash of their normalized path (see `hashPath`), so the same paths that are used to load
+/// files from disk can be used to find the assets in the pack.
+/// Note: All values are stored in little-endian byte order.
+/// </summary>
+class SR_API AssetPack final
+{
+public:
+    /// <summary>
+    /// The magic number at the start of an asset pack ("MPAK").
+    /// </summary>
+    static constexpr uint32_t Magic = 0x4B41504Du;
+
+    /// <summary>
+    /// The version of the asset pack format.
+    /// </summary>
+    static constexpr uint32_t Version = 1u;
+
+    /// <summary>
+    /// The alignment (in bytes) of the data of each asset in the pack.
+    /// This matches the alignment of the pixel buffer of an Image.
+    /// </summary>
+    static constexpr uint64_t DataAlignment = 64u;
+
+    /// <summary>
+    /// The header at the start of the pack file.
+    /// </summary>
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t numEntries;
+        uint32_t reserved;
+        uint64_t indexOffset;    // The offset of the (sorted) array of entries.
+        uint64_t stringsOffset;  // The offset of the paths of the assets.
+        uint64_t stringsSize;
+    };
+
+    /// <summary>
+    /// An entry in the index of the pack.
+    /// Entries are sorted by their ID and type.
+    /// </summary>
+    struct Entry
+    {
+        uint64_t         id;  // The hash of the asset's path.
+        AssetType        type;
+        AssetCompression compression;
+        uint64_t         offset;   // The offset of the data from the start of the file.
+        uint64_t         size;     // The size of the data in the pack.
+        uint64_t         rawSize;  // The size of the data after it is decompressed.
+        uint32_t         width;    // The width of an image (in pixels).
+        uint32_t         height;   // The height of an image (in pixels).
+        uint32_t         pathOffset;
+        uint32_t         pathLength;
+    };
+
+    /// <summary>
+    /// The data of a sprite sheet entry.
+    /// </summary>
+    struct SpriteSheetInfo
+    {
+        uint64_t imageId;  // The ID of the image entry.
+        uint32_t spriteWidth;
+        uint32_t spriteHeight;
+        uint32_t padding;
+        uint32_t margin;
+    };
+
+    static_assert( sizeof( Header ) == 40 );
+    static_assert( sizeof( Entry ) == 56 );
+    static_assert( sizeof( SpriteSheetInfo ) == 24 );
+
+    /// <summary>
+    /// Compute the ID of an asset from its path.
+    /// The path is normalized (and uses forward slashes) before it is hashed, so "assets/../assets/Map.png" and
+    /// "assets\Map.png" refer to the same asset.
+    /// </summary>
+    /// <param name="path">The path to the asset.</param>
+    /// <returns>The 64-bit FNV-1a hash of the normalized path (the same value as AssetId).</returns>
+    static uint64_t hashPath( const std::filesystem::path& path );
+
+    /// <summary>
+    /// Create an empty asset pack.
+    /// </summary>
+    AssetPack() = default;
+
+    /// <summary>
+    /// Open an asset pack.
+    /// If the pack could not be opened (or is not a valid asset pack), the pack is empty.
+    /// </summary>
+    /// <param name="packFile">The path to the pack file.</param>
+    explicit AssetPack( const std::filesystem::path& packFile );
+
+    ~AssetPack() = default;
+
+    AssetPack( const AssetPack& )                = default;
+    AssetPack( AssetPack&& ) noexcept            = default;
+    AssetPack& operator=( const AssetPack& )     = default;
+    AssetPack& operator=( AssetPack&& ) noexcept = default;
+
+    /// <summary>
+    /// Check if the pack was opened successfully.
+    /// </summary>
+    /// <returns>`true` if the pack is memory-mapped.</returns>
+    bool isOpen() const noexcept
+    {
+        return mapping != nullptr;
+    }
+
+    /// <summary>
+    /// Find an asset in the pack.
+    /// </summary>
+    /// <param name="id">The ID of the asset.</param>
+    /// <param name="type">The type of the asset.</param>
+    /// <returns>The entry of the asset, or `nullptr` if the asset is not in the pack.</returns>
+    const Entry* find( uint64_t id, AssetType type ) const noexcept;
+
+    /// <summary>
+    /// Find an asset in the pack.
+    /// </summary>
+    /// <param name="id">The ID of the asset.</param>
+    /// <param name="type">The type of the asset.</param>
+    /// <returns>The entry of the asset, or `nullptr` if the asset is not in the pack.</returns>
+    const Entry* find( AssetId id, AssetType type ) const noexcept
+    {
+        return find( id.getValue(), type );
+    }
+
+    /// <summary>
+    /// Find an asset in the pack.
+    /// </summary>
+    /// <param name="path">The path of the asset.</param>
+    /// <param name="type">The type of the asset.</param>
+    /// <returns>The entry of the asset, or `nullptr` if the asset is not in the pack.</returns>
+    const Entry* find( const std::filesystem::path& path, AssetType type ) const
+    {
+        return find( hashPath( path ), type );
+    }
+
+    /// <summary>
+    /// Get the data of an asset.
+    /// The data remains valid as long as the pack (or a copy of it) is open.
+    /// </summary>
+    /// <param name="entry">The entry of the asset.</param>
+    /// <returns>The data in the memory-mapped pack.</returns>
+    std::span<const std::byte> getData( const Entry& entry ) const noexcept;
+
+    /// <summary>
+    /// Get the memory-mapped pack file.
+    /// Keep a reference to the mapping to use the data of an entry without copying it (the data stays valid after the
+    /// pack is unmounted).
+    /// </summary>
+    /// <returns>The mapped pack file, or nullptr if the pack is not open.</returns>
+    std::shared_ptr<const MappedFile> getMapping() const noexcept
+    {
+        return mapping;
+    }
+
+    /// <summary>
+    /// Get the path that was used to add an asset to the pack.
+    /// </summary>
+    /// <param name="entry">The entry of the asset.</param>
+    /// <returns>The normalized path of the asset.</returns>
+    std::string_view getPath( const Entry& entry ) const noexcept;
+
+    /// <summary>
+    /// Get all of the entries in the pack.
+    /// </summary>
+    /// <returns>The index of the pack.</returns>
+    std::span<const Entry> getEntries() const noexcept
+    {
+        return entries;
+    }
+
+    /// <summary>
+    /// Create an image from an image entry.
+    /// The image uses the pixels in the memory-mapped file and keeps the mapping open.
+    /// </summary>
+    /// <param name="entry">An entry of type AssetType::Image.</param>
+    /// <returns>The image.</returns>
+    std::shared_ptr<Image> loadImage( const Entry& entry ) const;
+
+    /// <summary>
+    /// Get the slicing parameters of a sprite sheet entry.
+    /// </summary>
+    /// <param name="entry">An entry of type AssetType::SpriteSheet.</param>
+    /// <returns>The sprite sheet info.</returns>
+    const SpriteSheetInfo& getSpriteSheetInfo( const Entry& entry ) const noexcept;
+
+private:
+    std::shared_ptr<MappedFile> mapping;
+    std::span<const Entry>      entries;
+    std::string_view            strings;
+};
+}  // namespace Graphics
@@ -1,75 +1,245 @@
-#pragma once
-
-#include "Color.hpp"
-#include "Config.hpp"
-
-#include <glm/vec2.hpp>
-#include <stb_truetype.h>
-
-#include <filesystem>
-
-namespace Graphics
-{
-class Image;
-
-class SR_API Font
-{
-public:
-    /// <summary>
-    /// Create a default font.
-    /// Uses stb_easy_font to generate quad-based fonts.
-    /// </summary>
-    /// <param name="size">The size of the font (in pixels) to generate.</param>
-    explicit Font( float size = 1.5f );
-
-    /// <summary>
-    /// Load a font from a font file.
-    /// </summary>
-    /// <param name="fontFile">The TrueType font to load.</param>
-    /// <param name="size">(optional) The size of the font (in pixels) to generate. Default: 12</param>
-    /// <param name="firstChar">(optional) The first character in the font texture. Default: ' '.</param>
-    /// <param name="numChars">(optional) The number of characters in the font texture. Default: 96.</param>
-    Font( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u);
-
-    /// <summary>
-    /// Get the size of the area needed to render the given text using this font.
-    /// </summary>
-    /// <param name="text">The text to write.</param>
-    /// <returns>The size of the rectangle needed to render this font.</returns>
-    glm::vec2 getSize( std::string_view text ) const noexcept;
-
-    float getFontSize() const noexcept
-    {
-        return size;
-    }
-
-    // Font's can't be copied or moved (yet).
-    Font( const Font& font ) = delete;
-    Font( Font&& font )      = delete;
-    ~Font()                  = default;
-
-    Font& operator=( const Font& font )     = delete;
-    Font& operator=( Font&& font ) noexcept = delete;
-
-    /// <summary>
-    /// Default font uses stb_easy_font for quad font rendering.
-    /// </summary>
-    static const Font Default;
-
-private:
-    friend class Image;
-
-    void drawText( Image& image, std::wstring_view text, int x, int y, const Color& color ) const;
-    void drawText( Image& image, std::string_view text, int x, int y, const Color& color ) const;
-
-    // The font size.
-    float size;
-    uint32_t firstChar = 0;
-    uint32_t numChars = 0;
-
-    stbtt_fontinfo                     fontInfo;
-    std::unique_ptr<Image>             fontImage;
-    std::unique_ptr<stbtt_bakedchar[]> bakedChar;
-    std::vector<unsigned char>         fontData;
-};
-}  // namespace Graphics
+#pragma once
+
+#include "Color.hpp"
+#include "Config.hpp"
+#include "TextLayout.hpp"
+
+#include <glm/vec2.hpp>
+#include <stb_truetype.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Graphics
+{
+class GlyphAtlas;
+
+/// <summary>
+/// Determines how the glyphs of a font are stored in the glyph atlas.
+/// </summary>
+enum class FontMode
+{
+    Bitmap,  ///< Glyphs are rasterized at the size of the font and drawn without scaling.
+    SDF,     ///< Glyphs are stored as signed distance fields and can be drawn at any scale, with outlines and drop shadows.
+};
+
+class SR_API Font
+{
+public:
+    /// <summary>
+    /// The number of pixels around a signed distance field glyph.
+    /// This limits the width of outlines and soft shadows (relative to the font size).
+    /// </summary>
+    static constexpr int SDFPadding = 6;
+
+    /// <summary>
+    /// The value of the signed distance field on the edge of a glyph.
+    /// </summary>
+    static constexpr unsigned char SDFOnEdgeValue = 128;
+
+    /// <summary>
+    /// The change in the signed distance field value per pixel.
+    /// </summary>
+    static constexpr float SDFPixelDistScale = static_cast<float>( SDFOnEdgeValue ) / static_cast<float>( SDFPadding );
+
+    /// <summary>
+    /// Create a default font.
+    /// The quads generated by stb_easy_font are rasterized into the glyph atlas once,
+    /// so the default font is drawn with the same glyph blits as TrueType fonts.
+    /// </summary>
+    /// <param name="size">The size of the font (in pixels) to generate.</param>
+    explicit Font( float size = 1.5f );
+
+    /// <summary>
+    /// Load a font from a font file.
+    /// Glyphs are rasterized into the shared glyph atlas the first time they are used, so any
+    /// Unicode code point that is supported by the font can be rendered.
+    /// </summary>
+    /// <param name="fontFile">The TrueType font to load. The file is memory-mapped, not read into memory.</param>
+    /// <param name="size">(optional) The size of the font (in pixels) to generate. Default: 12</param>
+    /// <param name="firstChar">(optional) The first character to rasterize up front. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters to rasterize up front. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. For SDF fonts, the size is the size of
+    /// the distance field (32 is a good default) and text can be drawn at any size using TextStyle::scale. Default: Bitmap.</param>
+    /// <param name="prewarm">(optional) Rasterize the characters in the range [firstChar, firstChar + numChars) into the glyph atlas.
+    /// The glyph atlas is not thread-safe, so this must be `false` if the font is loaded on a background thread. Default: true.</param>
+    Font( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap, bool prewarm = true );
+
+    /// <summary>
+    /// Load a font from the contents of a font file (for example, a font in an asset pack).
+    /// </summary>
+    /// <param name="data">The contents of the TrueType font file. The data is copied.</param>
+    /// <param name="size">(optional) The size of the font (in pixels) to generate. Default: 12</param>
+    /// <param name="firstChar">(optional) The first character to rasterize up front. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters to rasterize up front. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. Default: Bitmap.</param>
+    /// <param name="prewarm">(optional) Rasterize the characters in the range [firstChar, firstChar + numChars) into the glyph atlas. Default: true.</param>
+    Font( std::span<const std::byte> data, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap, bool prewarm = true );
+
+    /// <summary>
+    /// Load a font from the contents of a font file without copying the data (for example, a font in a memory-mapped asset pack).
+    /// </summary>
+    /// <param name="data">The contents of the TrueType font file.</param>
+    /// <param name="storage">The owner of the data. The font keeps a reference to it for as long as the font is used.</param>
+    /// <param name="size">(optional) The size of the font (in pixels) to generate. Default: 12</param>
+    /// <param name="firstChar">(optional) The first character to rasterize up front. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters to rasterize up front. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. Default: Bitmap.</param>
+    /// <param name="prewarm">(optional) Rasterize the characters in the range [firstChar, firstChar + numChars) into the glyph atlas. Default: true.</param>
+    Font( std::span<const std::byte> data, std::shared_ptr<const void> storage, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap, bool prewarm = true );
+
+    /// <summary>
+    /// Get the size of the area needed to render the given text using this font.
+    /// Same as `measure( text )`.
+    /// </summary>
+    /// <param name="text">The text to write.</param>
+    /// <returns>The size of the rectangle needed to render this font.</returns>
+    glm::vec2 getSize( std::string_view text ) const noexcept;
+
+    /// <summary>
+    /// Measure the size of the area needed to render the given text using this font.
+    /// The width is the advance of the longest line and the height is the number of lines times the line height.
+    /// Lines are broken at newline characters and (if maxWidth is greater than 0) between words that don't fit on the line.
+    /// Measuring text does not allocate memory, and the results for recently measured strings are cached (per thread,
+    /// so text can be measured from any thread).
+    /// </summary>
+    /// <param name="text">The UTF-8 encoded text to measure.</param>
+    /// <param name="maxWidth">(optional) The width to wrap the text at. Default: 0 (no word wrap).</param>
+    /// <returns>The size of the text.</returns>
+    glm::vec2 measure( std::string_view text, float maxWidth = 0.0f ) const noexcept;
+
+    float getFontSize() const noexcept
+    {
+        return size;
+    }
+
+    /// <summary>
+    /// Get the distance between the baselines of two lines of text.
+    /// </summary>
+    /// <returns>The line height in pixels.</returns>
+    float getLineHeight() const noexcept
+    {
+        return lineHeight;
+    }
+
+    /// <summary>
+    /// Get the distance the pen moves after drawing a character.
+    /// </summary>
+    /// <param name="codepoint">The Unicode code point of the character.</param>
+    /// <returns>The advance in pixels.</returns>
+    float getAdvance( char32_t codepoint ) const noexcept;
+
+    /// <summary>
+    /// Get the adjustment of the advance between two characters.
+    /// Kerning is only applied to characters in the range that is preloaded when the font is created.
+    /// </summary>
+    /// <param name="first">The first character.</param>
+    /// <param name="second">The character that follows the first character.</param>
+    /// <returns>The kerning adjustment in pixels.</returns>
+    float getKerning( char32_t first, char32_t second ) const noexcept;
+
+    /// <summary>
+    /// Get how the glyphs of this font are stored in the glyph atlas.
+    /// </summary>
+    /// <returns>The font mode.</returns>
+    FontMode getMode() const noexcept
+    {
+        return mode;
+    }
+
+    /// <summary>
+    /// Get the amount of memory used by the font.
+    /// Glyphs in the shared glyph atlas are not included.
+    /// </summary>
+    /// <returns>The size (in bytes) of the font data and the metrics tables.</returns>
+    size_t getMemoryUsage() const noexcept
+    {
+        return sizeof( Font ) + fontData.size() + metrics.capacity() * sizeof( CharMetrics ) + kerning.capacity() * sizeof( KerningPair );
+    }
+
+    /// <summary>
+    /// Shape a string of text using this font.
+    /// The glyph rectangles are relative to the origin of the text. Glyphs that are not yet in the
+    /// shared glyph atlas are rasterized.
+    /// The glyphs are appended to the glyphs vector so the caller can reuse its memory.
+    /// </summary>
+    /// <param name="text">The UTF-8 encoded text to shape.</param>
+    /// <param name="glyphs">The vector to append the glyphs to.</param>
+    /// <param name="bounds">Receives the bounding rectangle of the glyphs.</param>
+    /// <param name="maxWidth">(optional) The width to wrap the text at. Default: 0 (no word wrap).</param>
+    void layout( std::string_view text, std::vector<Glyph>& glyphs, Math::RectI& bounds, float maxWidth = 0.0f ) const;
+    void layout( std::wstring_view text, std::vector<Glyph>& glyphs, Math::RectI& bounds, float maxWidth = 0.0f ) const;
+
+    // Font's can't be copied or moved (yet).
+    Font( const Font& font ) = delete;
+    Font( Font&& font )      = delete;
+    ~Font()                  = default;
+
+    Font& operator=( const Font& font )     = delete;
+    Font& operator=( Font&& font ) noexcept = delete;
+
+    /// <summary>
+    /// Default font uses stb_easy_font glyphs (printable ASCII characters only).
+    /// </summary>
+    static const Font Default;
+
+private:
+    // Metrics of a character in the preloaded range.
+    struct CharMetrics
+    {
+        float advance;
+        int   glyphIndex;
+    };
+
+    // The kerning between two characters in the preloaded range.
+    struct KerningPair
+    {
+        uint32_t key;  // ( first - firstChar ) << 16 | ( second - firstChar )
+        float    advance;
+    };
+
+    // Shape a sequence of Unicode code points.
+    template<typename Decoder>
+    void shape( Decoder&& decoder, float maxWidth, std::vector<Glyph>& glyphs, Math::RectI& bounds ) const;
+
+    // Append the glyphs of a character at the pen position.
+    void emitGlyph( GlyphAtlas& atlas, char32_t codepoint, float xPos, float yPos, std::vector<Glyph>& glyphs ) const;
+
+    // Get the atlas slot of a glyph (rasterizing it if necessary).
+    uint32_t getGlyph( GlyphAtlas& atlas, char32_t codepoint ) const;
+
+    // Initialize the font from fontData. Releases fontData if it is not a valid font.
+    bool loadFontData( uint32_t numChars, bool prewarm );
+
+    // Compute the advance and kerning tables for the preloaded range.
+    void loadMetrics( uint32_t numChars );
+
+    // Set up the metrics of the default font and (optionally) rasterize its glyphs.
+    void loadDefaultGlyphs( bool prewarm = true );
+
+    // The font size.
+    float    size;
+    FontMode mode = FontMode::Bitmap;
+    // The scale to convert font units to pixels.
+    float scale = 0.0f;
+    // The distance between two lines of text.
+    float lineHeight = 0.0f;
+    // Uniquely identifies the glyphs of this font in the glyph atlas.
+    uint32_t id = 0u;
+
+    // Advance and kerning tables for the characters in the range [firstChar, firstChar + metrics.size()).
+    char32_t                 firstChar = 32;
+    std::vector<CharMetrics> metrics;
+    std::vector<KerningPair> kerning;  // Sorted by key.
+
+    // The contents of the font file, either memory-mapped or owned by the font.
+    // The storage is shared so the data can outlive the asset pack (or the mapping) it came from.
+    stbtt_fontinfo                 fontInfo {};
+    std::span<const unsigned char> fontData;
+    std::shared_ptr<const void>    fontStorage;
+};
+}  // namespace Graphics
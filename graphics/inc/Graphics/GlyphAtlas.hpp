@@ -0,0 +1,275 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <Math/Rect.hpp>
+
+#include <glm/ext/vector_int2_sized.hpp>
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Graphics
+{
+struct Glyph;
+
+/// <summary>
+/// An 8-bit coverage atlas that is shared by all fonts.
+/// Glyphs are rasterized into the atlas the first time they are used and packed into shelves
+/// (rows of glyphs with similar heights). The atlas starts small and grows in height until it reaches
+/// the memory budget. After that, the least-recently used glyphs are evicted to make room for new glyphs.
+/// Each slot has a generation counter that is incremented when the glyph in the slot is evicted, so
+/// cached text layouts can detect that their glyphs are no longer resident.
+/// Note: The atlas is not thread-safe and should only be used on the thread that renders text.
+/// </summary>
+class SR_API GlyphAtlas final
+{
+public:
+    /// <summary>
+    /// An invalid slot index.
+    /// </summary>
+    static constexpr uint32_t InvalidSlot = 0xFFFFFFFFu;
+
+    /// <summary>
+    /// A glyph that is resident in the atlas.
+    /// </summary>
+    struct Entry
+    {
+        /// <summary>
+        /// The rectangle of the glyph in the atlas.
+        /// </summary>
+        Math::RectI rect;
+
+        /// <summary>
+        /// The offset of the top-left corner of the glyph bitmap from the pen position.
+        /// </summary>
+        glm::i32vec2 offset { 0 };
+
+        /// <summary>
+        /// Incremented every time the slot is evicted.
+        /// </summary>
+        uint32_t generation = 0u;
+    };
+
+    /// <summary>
+    /// Create a glyph atlas.
+    /// </summary>
+    /// <param name="width">(optional) The width of the atlas (in pixels). Default: 1024.</param>
+    /// <param name="memoryBudget">(optional) The maximum size of the atlas (in bytes). Default: 1 MiB.</param>
+    explicit GlyphAtlas( uint32_t width = 1024u, size_t memoryBudget = 1024u * 1024u );
+
+    ~GlyphAtlas() = default;
+
+    GlyphAtlas( const GlyphAtlas& )                = delete;
+    GlyphAtlas( GlyphAtlas&& ) noexcept            = default;
+    GlyphAtlas& operator=( const GlyphAtlas& )     = delete;
+    GlyphAtlas& operator=( GlyphAtlas&& ) noexcept = default;
+
+    /// <summary>
+    /// Get the atlas that is shared by all fonts.
+    /// </summary>
+    /// <returns>The shared glyph atlas.</returns>
+    static GlyphAtlas& getShared();
+
+    /// <summary>
+    /// Compute the key of a glyph.
+    /// </summary>
+    /// <param name="fontId">The unique ID of the font.</param>
+    /// <param name="codepoint">The Unicode code point of the glyph.</param>
+    /// <returns>The key that identifies the glyph in the atlas.</returns>
+    static constexpr uint64_t makeKey( uint32_t fontId, char32_t codepoint ) noexcept
+    {
+        return static_cast<uint64_t>( fontId ) << 32 | codepoint;
+    }
+
+    /// <summary>
+    /// Mark the start of a batch of glyph lookups (for example, shaping a string of text).
+    /// Glyphs that are used during the current batch are never evicted.
+    /// </summary>
+    void beginBatch() noexcept
+    {
+        ++tick;
+    }
+
+    /// <summary>
+    /// Find a glyph in the atlas and mark it as used.
+    /// </summary>
+    /// <param name="key">The key of the glyph.</param>
+    /// <returns>The slot of the glyph, or `InvalidSlot` if the glyph is not in the atlas.</returns>
+    uint32_t find( uint64_t key ) noexcept;
+
+    /// <summary>
+    /// Allocate space for a glyph in the atlas. Least-recently used glyphs are evicted if there is not enough space.
+    /// The glyph's pixels must be written to `data( slot )` after it has been inserted.
+    /// </summary>
+    /// <param name="key">The key of the glyph.</param>
+    /// <param name="width">The width of the glyph bitmap.</param>
+    /// <param name="height">The height of the glyph bitmap.</param>
+    /// <param name="offset">The offset of the glyph bitmap from the pen position.</param>
+    /// <returns>The slot of the glyph, or `InvalidSlot` if the glyph does not fit in the atlas.</returns>
+    uint32_t insert( uint64_t key, int width, int height, const glm::i32vec2& offset );
+
+    /// <summary>
+    /// Mark a glyph as used. Cached layouts touch their glyphs when they are drawn.
+    /// </summary>
+    /// <param name="slot">The slot of the glyph.</param>
+    void touch( uint32_t slot ) noexcept
+    {
+        slots[slot].lastUsed = tick;
+    }
+
+    /// <summary>
+    /// Check if all of the glyphs are still resident in the atlas.
+    /// </summary>
+    /// <param name="glyphs">The glyphs to check.</param>
+    /// <returns>`true` if none of the glyphs have been evicted.</returns>
+    bool isResident( std::span<const Glyph> glyphs ) const noexcept;
+
+    /// <summary>
+    /// Get a glyph in the atlas.
+    /// </summary>
+    /// <param name="slot">The slot of the glyph.</param>
+    /// <returns>The glyph entry.</returns>
+    const Entry& getEntry( uint32_t slot ) const noexcept
+    {
+        return slots[slot].entry;
+    }
+
+    /// <summary>
+    /// Get a pointer to the top-left pixel of a glyph in the atlas.
+    /// </summary>
+    /// <param name="slot">The slot of the glyph.</param>
+    /// <returns>A pointer to the glyph's pixels. Rows are `getWidth()` bytes apart.</returns>
+    uint8_t* data( uint32_t slot ) noexcept
+    {
+        const Math::RectI& rect = slots[slot].entry.rect;
+        return pixels.data() + static_cast<size_t>( rect.top ) * width + rect.left;
+    }
+
+    /// <summary>
+    /// Get a pointer to the atlas pixels (8-bit coverage values).
+    /// </summary>
+    /// <returns>A pointer to the top-left pixel of the atlas.</returns>
+    const uint8_t* data() const noexcept
+    {
+        return pixels.data();
+    }
+
+    /// <summary>
+    /// Sample the atlas using bilinear filtering.
+    /// </summary>
+    /// <param name="texCoord">The normalized texture coordinate to sample.</param>
+    /// <returns>The filtered value in the range [0..1].</returns>
+    float sample( const glm::vec2& texCoord ) const noexcept
+    {
+        const float fx = texCoord.x * static_cast<float>( width ) - 0.5f;
+        const float fy = texCoord.y * static_cast<float>( height ) - 0.5f;
+        const float x  = std::floor( fx );
+        const float y  = std::floor( fy );
+        const float tx = fx - x;
+        const float ty = fy - y;
+
+        const int maxX = static_cast<int>( width ) - 1;
+        const int maxY = static_cast<int>( height ) - 1;
+        const int x0   = std::clamp( static_cast<int>( x ), 0, maxX );
+        const int y0   = std::clamp( static_cast<int>( y ), 0, maxY );
+        const int x1   = std::min( x0 + 1, maxX );
+        const int y1   = std::min( y0 + 1, maxY );
+
+        const uint8_t* row0 = pixels.data() + static_cast<size_t>( y0 ) * width;
+        const uint8_t* row1 = pixels.data() + static_cast<size_t>( y1 ) * width;
+
+        const float top    = row0[x0] + ( row0[x1] - row0[x0] ) * tx;
+        const float bottom = row1[x0] + ( row1[x1] - row1[x0] ) * tx;
+
+        return ( top + ( bottom - top ) * ty ) * ( 1.0f / 255.0f );
+    }
+
+    /// <summary>
+    /// Get the width (and stride) of the atlas.
+    /// </summary>
+    /// <returns>The width of the atlas in pixels.</returns>
+    uint32_t getWidth() const noexcept
+    {
+        return width;
+    }
+
+    /// <summary>
+    /// Get the current height of the atlas.
+    /// </summary>
+    /// <returns>The height of the atlas in pixels.</returns>
+    uint32_t getHeight() const noexcept
+    {
+        return height;
+    }
+
+    /// <summary>
+    /// Get the number of glyphs in the atlas.
+    /// </summary>
+    /// <returns>The number of resident glyphs.</returns>
+    size_t size() const noexcept
+    {
+        return lookup.size();
+    }
+
+    /// <summary>
+    /// Remove all glyphs from the atlas.
+    /// </summary>
+    void clear() noexcept;
+
+private:
+    // A free horizontal span in a shelf.
+    struct Span
+    {
+        int x;
+        int width;
+    };
+
+    // A row of glyphs.
+    struct Shelf
+    {
+        Shelf( int y, int height )
+        : y { y }
+        , height { height }
+        {}
+
+        int               y;
+        int               height;
+        int               used = 0;  // The number of glyphs in the shelf.
+        std::vector<Span> free;
+    };
+
+    struct Slot
+    {
+        Entry    entry;
+        uint64_t key      = 0u;
+        uint64_t lastUsed = 0u;
+        int      shelfY   = 0;  // The y-coordinate of the shelf that contains the glyph.
+        bool     resident = false;
+    };
+
+    // Try to allocate a rectangle (including padding) in one of the shelves.
+    bool allocate( int w, int h, Math::RectI& rect, int& shelfY );
+
+    // Evict the glyph in a slot and return its space to the shelf.
+    void evict( uint32_t slot );
+
+    uint32_t width;
+    uint32_t height    = 0u;
+    uint32_t maxHeight = 0u;
+
+    std::vector<uint8_t>                   pixels;
+    std::vector<Shelf>                     shelves;
+    std::vector<Slot>                      slots;
+    std::vector<uint32_t>                  freeSlots;
+    std::unordered_map<uint64_t, uint32_t> lookup;
+
+    // Incremented at the start of every batch.
+    uint64_t tick = 1u;
+};
+}  // namespace Graphics
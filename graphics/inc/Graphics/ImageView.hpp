@@ -0,0 +1,736 @@
+#pragma once
+
+#include "BlendMode.hpp"
+#include "Color.hpp"
+#include "Config.hpp"
+#include "Enums.hpp"
+#include "ShaderInput.hpp"
+#include "SpriteInstance.hpp"
+#include "TextStyle.hpp"
+#include "Vertex.hpp"
+
+#include <Math/AABB.hpp>
+#include <Math/Transform2D.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <glm/ext/vector_int2_sized.hpp>
+#include <glm/vec2.hpp>
+
+namespace Graphics
+{
+
+class Sprite;
+class SpriteSheet;
+class Font;
+class TextLayout;
+struct Glyph;
+
+namespace detail
+{
+struct TriangleSetup;
+}
+
+/// <summary>
+/// A non-owning view into a 2D pixel buffer.
+/// A view is described by a pointer to the first pixel, the width and height of the
+/// view (in pixels), and the stride (in pixels) between the start of two consecutive rows.
+/// Because the stride does not have to match the width, a view can reference a rectangular
+/// region of a larger image (a tile of the screen, a UI panel, or a sprite in a sprite sheet)
+/// without copying any pixels.
+/// Like std::span, an ImageView has pointer semantics: copying a view does not copy
+/// the pixels, and the viewed pixels must outlive the view.
+/// All draw primitives are implemented on the ImageView and are therefore available
+/// on both images and views.
+/// </summary>
+class SR_API ImageView
+{
+public:
+    /// <summary>
+    /// Default construct an empty view.
+    /// </summary>
+    ImageView() = default;
+
+    /// <summary>
+    /// Construct a view over an existing pixel buffer.
+    /// </summary>
+    /// <param name="data">A pointer to the top-left pixel of the view.</param>
+    /// <param name="width">The width of the view (in pixels).</param>
+    /// <param name="height">The height of the view (in pixels).</param>
+    /// <param name="stride">(optional) The number of pixels between the start of two consecutive rows. Default: width.</param>
+    ImageView( Color* data, uint32_t width, uint32_t height, uint32_t stride = 0u ) noexcept;
+
+    ImageView( const ImageView& )                = default;
+    ImageView( ImageView&& ) noexcept            = default;
+    ImageView& operator=( const ImageView& )     = default;
+    ImageView& operator=( ImageView&& ) noexcept = default;
+    ~ImageView()                                 = default;
+
+    /// <summary>
+    /// Check if this is a valid view.
+    /// </summary>
+    explicit operator bool() const noexcept
+    {
+        return m_data != nullptr;
+    }
+
+    /// <summary>
+    /// Get a view of a rectangular region of this view.
+    /// The rectangle is clamped to the bounds of this view.
+    /// </summary>
+    /// <param name="rect">The region of this view (in pixels).</param>
+    /// <returns>A view that references the pixels of the region. The returned view is empty if the region does not overlap this view.</returns>
+    ImageView getView( const Math::RectI& rect ) noexcept;
+
+    /// <summary>
+    /// Get a read-only view of a rectangular region of this view.
+    /// The rectangle is clamped to the bounds of this view.
+    /// </summary>
+    /// <param name="rect">The region of this view (in pixels).</param>
+    /// <returns>A read-only view that references the pixels of the region. The returned view is empty if the region does not overlap this view.</returns>
+    const ImageView getView( const Math::RectI& rect ) const noexcept
+    {
+        return const_cast<ImageView*>( this )->getView( rect );
+    }
+
+    /// <summary>
+    /// Clear the image to a single color.
+    /// </summary>
+    /// <param name="color">The color to clear the screen to.</param>
+    void clear( const Color& color ) noexcept;
+
+    /// <summary>
+    /// Copy a region of the source image to a region of this image.
+    /// If the source and destination regions are different, the image will be scaled.
+    /// </summary>
+    /// <param name="srcImage">The source image to copy.</param>
+    /// <param name="srcRect">(optional) The region to copy from. By default, this is the size of the source image.</param>
+    /// <param name="dstRect">(optional) The destination region to copy to. By default, this is the size of the source image.</param>
+    /// <param name="blendMode">(optional) The blend mode to use for the copy. By default, no blending is applied.</param>
+    void copy( const ImageView& srcImage, std::optional<Math::RectI> srcRect = {}, std::optional<Math::RectI> dstRect = {}, const BlendMode& blendMode = {} );
+
+    /// <summary>
+    /// This is a simple 1:1 pixel copy to from the source image to the destination image.
+    /// If you don't need to scale, translate, or rotate the source image, this method
+    /// will be faster than using a sprite.
+    /// </summary>
+    /// <param name="srcImage">The source image to copy to this one.</param>
+    /// <param name="x">The x-coordinate of the top-left corner of the destination image.</param>
+    /// <param name="y">The y-coordinate of the top-left corner of the destination image.</param>
+    void copy( const ImageView& srcImage, int x, int y );
+
+    /// <summary>
+    /// Draw a line on the image.
+    /// </summary>
+    /// <param name="x0">The x-coordinate of the start point of the line.</param>
+    /// <param name="y0">The y-coordinate of the start point of the line.</param>
+    /// <param name="x1">The x-coordinate of the end point of the line.</param>
+    /// <param name="y1">The y-coordinate of the end point of the line.</param>
+    /// <param name="color">The color of the line.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    void drawLine( int x0, int y0, int x1, int y1, const Color& color, const BlendMode& blendMode = {} ) noexcept;
+
+    /// <summary>
+    /// Draw a line on the image.
+    /// </summary>
+    /// <param name="x0">The x-coordinate of the start point of the line.</param>
+    /// <param name="y0">The y-coordinate of the start point of the line.</param>
+    /// <param name="x1">The x-coordinate of the end point of the line.</param>
+    /// <param name="y1">The y-coordinate of the end point of the line.</param>
+    /// <param name="color">The color of the line.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    void drawLine( float x0, float y0, float x1, float y1, const Color& color, const BlendMode& blendMode = {} ) noexcept
+    {
+        drawLine( static_cast<int>( x0 ), static_cast<int>( y0 ), static_cast<int>( x1 ), static_cast<int>( y1 ), color, blendMode );
+    }
+
+    /// <summary>
+    /// Draw a line on the image.
+    /// </summary>
+    /// <param name="p0">The start point.</param>
+    /// <param name="p1">The end point.</param>
+    /// <param name="color">The color of the line.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    void drawLine( const glm::ivec2& p0, const glm::ivec2& p1, const Color& color, const BlendMode& blendMode = {} ) noexcept
+    {
+        drawLine( p0.x, p0.y, p1.x, p1.y, color, blendMode );
+    }
+
+    /// <summary>
+    /// Draw a line on the image.
+    /// </summary>
+    /// <param name="p0">The start point.</param>
+    /// <param name="p1">The end point.</param>
+    /// <param name="color">The color of the line.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    void drawLine( const glm::vec2& p0, const glm::vec2& p1, const Color& color, const BlendMode& blendMode = {} ) noexcept
+    {
+        drawLine( p0.x, p0.y, p1.x, p1.y, color, blendMode );
+    }
+
+    /// <summary>
+    /// Draw a line on the image.
+    /// </summary>
+    /// <param name="line">The line to draw.</param>
+    /// <param name="color">The color of the line.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    void drawLine( const Math::Line& line, const Color& color, const BlendMode& blendMode = {} ) noexcept
+    {
+        drawLine( line.p0.x, line.p0.y, line.p1.x, line.p1.y, color, blendMode );
+    }
+
+    /// <summary>
+    /// Plot a 2D triangle.
+    /// </summary>
+    /// <param name="p0">The first triangle coordinate.</param>
+    /// <param name="p1">The second triangle coordinate.</param>
+    /// <param name="p2">The third triangle coordinate.</param>
+    /// <param name="color">The triangle color.</param>
+    /// <param name="blendMode">The blend mode to apply.</param>
+    /// <param name="fillMode">The fill mode to use when rendering.</param>
+    void drawTriangle( const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept;
+
+    /// <summary>
+    /// Draw a rectangle to the screen.
+    /// </summary>
+    /// <typeparam name="T">The rectangle type.</typeparam>
+    /// <param name="rect">The rectangle to draw.</param>
+    /// <param name="color">The color to draw the rectangle with.</param>
+    /// <param name="blendMode">(optional) The blend mode to use when drawing. Default: No blending.</param>
+    /// <param name="fillMode">(optional) The fill mode to use. Default: Solid fill.</param>
+    template<typename T>
+    void drawRectangle( const Math::Rect<T>& rect, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept;
+
+    /// <summary>
+    /// Draw a solid or wireframe 2D quad on the screen.
+    /// </summary>
+    /// <param name="p0">The first quad point.</param>
+    /// <param name="p1">The second quad point.</param>
+    /// <param name="p2">The third quad point.</param>
+    /// <param name="p3">The fourth quad point.</param>
+    /// <param name="color">The color of the quad.</param>
+    /// <param name="blendMode">(optional) The blending mode to apply when rendering. Default: No blending.</param>
+    /// <param name="fillMode">(optional) The fill mode to use. Default: Solid.</param>
+    void drawQuad( const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept;
+
+    /// <summary>
+    /// Draw a textured 2D quad on the screen.
+    /// </summary>
+    /// <param name="v0">The first vertex.</param>
+    /// <param name="v1">The second vertex.</param>
+    /// <param name="v2">The third vertex.</param>
+    /// <param name="v3">The fourth vertex.</param>
+    /// <param name="image">The texture to use to render the quad. Texture coordinates are relative to the view.</param>
+    /// <param name="addressMode">(optional) The address mode to use when sampling the image. Default: AddressMode::Wrap</param>
+    /// <param name="blendMode">(optional) The blending mode to apply. Default: No blending.</param>
+    void drawQuad( const Vertex& v0, const Vertex& v1, const Vertex& v2, const Vertex& v3, const ImageView& image, AddressMode addressMode = AddressMode::Wrap, const BlendMode& blendMode = {} );
+
+    /// <summary>
+    /// Draw a 2D quad using a custom pixel shader.
+    /// The shader is invoked for every covered pixel (see ShaderInput) and is inlined at compile time.
+    /// </summary>
+    /// <typeparam name="Shader">The pixel shader type.</typeparam>
+    /// <param name="v0">The first vertex.</param>
+    /// <param name="v1">The second vertex.</param>
+    /// <param name="v2">The third vertex.</param>
+    /// <param name="v3">The fourth vertex.</param>
+    /// <param name="shader">The pixel shader to invoke for each covered pixel.</param>
+    template<PixelShader Shader>
+    void drawQuad( const Vertex& v0, const Vertex& v1, const Vertex& v2, const Vertex& v3, const Shader& shader );
+
+    /// <summary>
+    /// Draw an indexed list of textured triangles.
+    /// The vertices are snapped to a sub-pixel grid and bounded once, and the triangles
+    /// are binned into horizontal bands of the image which are rendered in parallel.
+    /// Triangles are rasterized using the top-left fill rule, so pixels on an edge that is
+    /// shared by two triangles are drawn exactly once (no gaps or double blending).
+    /// </summary>
+    /// <param name="vertices">The vertices of the mesh (in image space).</param>
+    /// <param name="indices">Three indices per triangle into the vertex buffer.</param>
+    /// <param name="texture">The texture to use to render the triangles. Texture coordinates are normalized.</param>
+    /// <param name="addressMode">(optional) The address mode to use when sampling the texture. Default: AddressMode::Wrap</param>
+    /// <param name="blendMode">(optional) The blending mode to apply. Default: No blending.</param>
+    void drawTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, const ImageView& texture, AddressMode addressMode = AddressMode::Wrap, const BlendMode& blendMode = {} );
+
+    /// <summary>
+    /// Draw an indexed list of triangles using a custom pixel shader.
+    /// The shader is invoked for every covered pixel (see ShaderInput) and is inlined at compile time.
+    /// Note: The shader is invoked concurrently from multiple threads.
+    /// </summary>
+    /// <typeparam name="Shader">The pixel shader type.</typeparam>
+    /// <param name="vertices">The vertices of the mesh (in image space).</param>
+    /// <param name="indices">Three indices per triangle into the vertex buffer.</param>
+    /// <param name="shader">The pixel shader to invoke for each covered pixel.</param>
+    template<PixelShader Shader>
+    void drawTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, const Shader& shader );
+
+    /// <summary>
+    /// Draw an axis-aligned bounding box to the image.
+    /// </summary>
+    /// <param name="aabb">The AABB to draw.</param>
+    /// <param name="color">The color of the AABB.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    /// <param name="fillMode">The fill mode to use to draw the AABB.</param>
+    void drawAABB( Math::AABB aabb, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept;
+
+    /// <summary>
+    /// Draw a circle.
+    /// </summary>
+    /// <param name="circle">The circle to draw.</param>
+    /// <param name="color">The color of the circle.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    /// <param name="fillMode">The fill mode to use.</param>
+    void drawCircle( const Math::Circle& circle, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept;
+
+    /// <summary>
+    /// Draw a circle from a sphere.
+    /// </summary>
+    /// <param name="sphere">The sphere that represents the center point and radius of the circle.</param>
+    /// <param name="color">The color of the circle.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    /// <param name="fillMode">The fill mode to use.</param>
+    void drawCircle( const Math::Sphere& sphere, const Color& color, const BlendMode& blendMode = {}, FillMode fillMode = FillMode::Solid ) noexcept
+    {
+        drawCircle( Math::Circle { sphere.center, sphere.radius }, color, blendMode, fillMode );
+    }
+
+    /// <summary>
+    /// Draw a circle.
+    /// </summary>
+    /// <param name="center">The center point of the circle.</param>
+    /// <param name="radius">The radius of the circle.</param>
+    /// <param name="color">The color of the circle.</param>
+    /// <param name="blendMode">The blend mode to use.</param>
+    /// <param name="fillMode">The fill mode to use.</param>
+    void drawCircle( const glm::vec2& center, float radius, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+    {
+        drawCircle( Math::Circle { center, radius }, color, blendMode, fillMode );
+    }
+
+    /// <summary>
+    /// Draw a sprite on the screen using a 3x3 transformation matrix.
+    /// </summary>
+    /// <param name="sprite">The sprite the draw.</param>
+    /// <param name="matrix">The matrix to apply to the sprite before drawing.</param>
+    void drawSprite( const Sprite& sprite, const glm::mat3& matrix ) noexcept;
+
+    /// <summary>
+    /// Draw a sprite on the screen using the given transform.
+    /// </summary>
+    /// <param name="sprite">The sprite to draw.</param>
+    /// <param name="transform">The transform to apply to the sprite.</param>
+    void drawSprite( const Sprite& sprite, const Math::Transform2D& transform ) noexcept
+    {
+        drawSprite( sprite, transform.getTransform() );
+    }
+
+    /// <summary>
+    /// Draw a sprite on the screen without any transformation applied to the sprite.
+    /// </summary>
+    /// <param name="sprite">The sprite to draw.</param>
+    /// <param name="x">The x-coordinate on the screen.</param>
+    /// <param name="y">The y-coordinate on the screen.</param>
+    void drawSprite( const Sprite& sprite, int x, int y ) noexcept;
+
+    /// <summary>
+    /// Draw many sprites from the same sprite sheet.
+    /// Instances are culled against the bounds of this image once, then binned into
+    /// horizontal bands of the image which are rendered in parallel. Within a band,
+    /// instances are drawn in submission order so overlapping sprites are composited
+    /// the same way as consecutive calls to drawSprite.
+    /// Instances without rotation or scale (only translation and flip) use a direct
+    /// blit, other instances are sampled through the inverse of their transform.
+    /// </summary>
+    /// <param name="sheet">The sprite sheet that contains the sprites to draw.</param>
+    /// <param name="instances">The sprite instances to draw.</param>
+    void drawSprites( const SpriteSheet& sheet, std::span<const SpriteInstance> instances );
+
+    /// <summary>
+    /// Draw text to the image.
+    /// </summary>
+    /// <param name="font">The font to use for font.</param>
+    /// <param name="x">The x-coordinate of the top-left corner of the text.</param>
+    /// <param name="y">The y-coordinate of the top-left corner fo the text.</param>
+    /// <param name="text">The text to print to the screen.</param>
+    /// <param name="color">The color of the text to draw on the screen.</param>
+    void drawText( const Font& font, std::string_view text, int x, int y, const Color& color );
+    void drawText( const Font& font, std::wstring_view text, int x, int y, const Color& color );
+
+    /// <summary>
+    /// Draw text that was shaped in advance.
+    /// Prefer this over drawing a string if the text does not change every frame.
+    /// </summary>
+    /// <param name="layout">The text layout to draw.</param>
+    /// <param name="x">The x-coordinate of the origin of the text.</param>
+    /// <param name="y">The y-coordinate of the origin of the text.</param>
+    /// <param name="color">The color of the text.</param>
+    void drawText( const TextLayout& layout, int x, int y, const Color& color );
+
+    /// <summary>
+    /// Draw text that was shaped in advance with a text style.
+    /// Signed distance field fonts support scaling, outlines and drop shadows.
+    /// Bitmap fonts only support drop shadows.
+    /// </summary>
+    /// <param name="layout">The text layout to draw.</param>
+    /// <param name="x">The x-coordinate of the origin of the text.</param>
+    /// <param name="y">The y-coordinate of the origin of the text.</param>
+    /// <param name="style">The style of the text.</param>
+    void drawText( const TextLayout& layout, int x, int y, const TextStyle& style );
+
+    /// <summary>
+    /// Draw glyphs that were shaped with a font.
+    /// Glyph quads are axis-aligned and unscaled, so each glyph is alpha-blended directly from the glyph atlas.
+    /// </summary>
+    /// <param name="font">The font that was used to shape the glyphs.</param>
+    /// <param name="glyphs">The glyphs to draw.</param>
+    /// <param name="x">The x-coordinate of the origin of the text.</param>
+    /// <param name="y">The y-coordinate of the origin of the text.</param>
+    /// <param name="color">The color of the text.</param>
+    void drawGlyphs( const Font& font, std::span<const Glyph> glyphs, int x, int y, const Color& color );
+    void drawGlyphs( const Font& font, std::span<const Glyph> glyphs, int x, int y, const TextStyle& style );
+
+    /// <summary>
+    /// Plot a single pixel to the image. Out-of-bounds coordinates are discarded.
+    /// </summary>
+    /// <param name="x">The x-coordinate to plot.</param>
+    /// <param name="y">The y-coordinate to plot.</param>
+    /// <param name="src">The source color of the pixel to plot.</param>
+    /// <param name="blendMode">The blend mode to apply.</param>
+    template<bool BoundsCheck = true, bool Blending = true>
+    void plot( uint32_t x, uint32_t y, const Color& src, const BlendMode& blendMode = {} ) noexcept
+    {
+        if constexpr ( BoundsCheck )
+        {
+            if ( x >= m_width || y >= m_height )
+                return;
+        }
+        else
+        {
+            assert( x < m_width );
+            assert( y < m_height );
+        }
+
+        const size_t i = static_cast<size_t>( y ) * m_stride + x;
+        if constexpr ( Blending )
+        {
+            const Color dst = m_data[i];
+            m_data[i]       = blendMode.Blend( src, dst );
+        }
+        else
+        {
+            m_data[i] = src;
+        }
+    }
+
+    /// <summary>
+    /// Sample the image at integer coordinates.
+    /// </summary>
+    /// <param name="u">The U texture coordinate.</param>
+    /// <param name="v">The V texture coordinate.</param>
+    /// <param name="addressMode">Determines how to apply out-of-bounds texture coordinates.</param>
+    /// <returns>The color of the texel at the given UV coordinates.</returns>
+    const Color& sample( int u, int v, AddressMode addressMode = AddressMode::Wrap ) const noexcept;
+
+    /// <summary>
+    /// Sample the image at integer coordinates.
+    /// </summary>
+    /// <param name="uv">The texture coordinates.</param>
+    /// <param name="addressMode">The address mode to use during sampling.</param>
+    /// <returns>The color of the texel at the given UV coordinates.</returns>
+    const Color& sample( const glm::ivec2& uv, AddressMode addressMode = AddressMode::Wrap ) const noexcept
+    {
+        return sample( uv.x, uv.y, addressMode );
+    }
+
+    /// <summary>
+    /// Sample the image using normalized texture coordinates (in the range from [0..1]).
+    /// </summary>
+    /// <param name="u">The normalized U texture coordinate.</param>
+    /// <param name="v">The normalized V texture coordinate.</param>
+    /// <param name="addressMode">The addressing mode to use during sampling.</param>
+    /// <returns>The color of the texel at the given UV texture coordinates.</returns>
+    const Color& sample( float u, float v, AddressMode addressMode = AddressMode::Wrap ) const noexcept
+    {
+        return sample( static_cast<int>( std::round( u * static_cast<float>( m_width ) ) ), static_cast<int>( std::round( v * static_cast<float>( m_height ) ) ), addressMode );
+    }
+
+    /// <summary>
+    /// Sample the image using normalized texture coordinates (in the range from [0..1]).
+    /// </summary>
+    /// <param name="uv">The normalized texture coordinates.</param>
+    /// <param name="addressMode">The addressing mode to use during sampling.</param>
+    /// <returns>The color of the texel at the given UV texture coordinates.</returns>
+    const Color& sample( const glm::vec2& uv, AddressMode addressMode = AddressMode::Wrap ) const noexcept
+    {
+        return sample( uv.x, uv.y, addressMode );
+    }
+
+    const Color& operator()( uint32_t x, uint32_t y ) const
+    {
+        assert( x < m_width );
+        assert( y < m_height );
+
+        return m_data[static_cast<uint64_t>( y ) * m_stride + x];
+    }
+
+    Color& operator()( uint32_t x, uint32_t y )
+    {
+        assert( x < m_width );
+        assert( y < m_height );
+
+        return m_data[static_cast<uint64_t>( y ) * m_stride + x];
+    }
+
+    uint32_t getWidth() const noexcept
+    {
+        return m_width;
+    }
+
+    uint32_t getHeight() const noexcept
+    {
+        return m_height;
+    }
+
+    /// <summary>
+    /// Get the number of pixels between the start of two consecutive rows.
+    /// </summary>
+    /// <returns>The row stride (in pixels).</returns>
+    uint32_t getStride() const noexcept
+    {
+        return m_stride;
+    }
+
+    /// <summary>
+    /// Get a rectangle that covers the entire image.
+    /// </summary>
+    /// <returns></returns>
+    Math::RectI getRect() const noexcept
+    {
+        return { 0, 0, static_cast<int>( m_width ), static_cast<int>( m_height ) };
+    }
+
+    /// <summary>
+    /// Get a pointer to the pixel buffer.
+    /// Note: Rows are `getStride()` pixels apart.
+    /// </summary>
+    /// <returns>A pointer to the pixel buffer.</returns>
+    Color* data() noexcept
+    {
+        return m_data;
+    }
+
+    /// <summary>
+    /// Get a read-only pointer to the pixel buffer.
+    /// Note: Rows are `getStride()` pixels apart.
+    /// </summary>
+    /// <returns>A read-only pointer to the pixel buffer.</returns>
+    const Color* data() const noexcept
+    {
+        return m_data;
+    }
+
+protected:
+    // Snap, bound and cull the triangles of an indexed triangle list.
+    void setupTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, std::vector<detail::TriangleSetup>& triangles ) const;
+
+    // Update the dimensions of the view (used by Image when the pixel buffer is (re)allocated).
+    void reset( Color* data, uint32_t width, uint32_t height, uint32_t stride ) noexcept;
+
+    // Pointer to the top-left pixel.
+    Color*   m_data   = nullptr;
+    uint32_t m_width  = 0u;
+    uint32_t m_height = 0u;
+    // The number of pixels between the start of two consecutive rows.
+    uint32_t m_stride = 0u;
+    // Axis-aligned bounding box used for screen clipping.
+    Math::AABB m_AABB;
+};
+
+template<typename T>
+void ImageView::drawRectangle( const Math::Rect<T>& rect, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+{
+    drawAABB( Math::AABB::fromRect( rect ), color, blendMode, fillMode );
+}
+
+namespace detail
+{
+// The height (in pixels) of the horizontal bands that batched primitives are binned into.
+// Each band is rendered by a single thread, so bands never write to the same pixels.
+constexpr int BandHeight = 32;
+
+// Number of sub-pixel bits used to snap triangle vertices to a fixed-point grid.
+constexpr int SubPixelBits  = 4;
+constexpr int SubPixelScale = 1 << SubPixelBits;
+
+// Bin items (with an inclusive minY and maxY) into horizontal bands.
+// An item that spans multiple bands is added to each band it overlaps.
+// The items of band b are bandItems[bandOffsets[b]...bandOffsets[b + 1]) in the same order as items.
+template<typename T>
+void binIntoBands( const std::vector<T>& items, int numBands, std::vector<uint32_t>& bandOffsets, std::vector<uint32_t>& bandItems )
+{
+    bandOffsets.assign( static_cast<size_t>( numBands ) + 1, 0u );
+    for ( const T& item: items )
+    {
+        for ( int b = item.minY / BandHeight; b <= item.maxY / BandHeight; ++b )
+            ++bandOffsets[b + 1];
+    }
+
+    for ( int b = 0; b < numBands; ++b )
+        bandOffsets[b + 1] += bandOffsets[b];
+
+    bandItems.resize( bandOffsets.back() );
+    std::vector<uint32_t> bandCursor( bandOffsets.begin(), bandOffsets.end() - 1 );
+    for ( uint32_t i = 0; i < static_cast<uint32_t>( items.size() ); ++i )
+    {
+        for ( int b = items[i].minY / BandHeight; b <= items[i].maxY / BandHeight; ++b )
+            bandItems[bandCursor[b]++] = i;
+    }
+}
+
+// An edge function E(x, y) = A * x + B * y + C in fixed-point coordinates.
+struct EdgeFunction
+{
+    EdgeFunction() = default;
+
+    EdgeFunction( const glm::i64vec2& v0, const glm::i64vec2& v1 ) noexcept
+    : A { v0.y - v1.y }
+    , B { v1.x - v0.x }
+    , C { v0.x * v1.y - v0.y * v1.x }
+    {
+        // Top-left fill rule: pixels exactly on a top or left edge are inside the triangle,
+        // pixels exactly on a bottom or right edge are not. This guarantees that pixels on an
+        // edge that is shared by two triangles are drawn exactly once.
+        const bool isTopLeft = A > 0 || ( A == 0 && B > 0 );
+        bias                 = isTopLeft ? 0 : -1;
+    }
+
+    int64_t operator()( int64_t x, int64_t y ) const noexcept
+    {
+        return A * x + B * y + C;
+    }
+
+    int64_t A = 0, B = 0, C = 0;
+    int64_t bias = 0;
+};
+
+// A triangle that passed culling.
+struct TriangleSetup
+{
+    // Edge functions opposite to vertex 0, 1, and 2.
+    EdgeFunction e0, e1, e2;
+    // 1 / (2 * area) of the triangle (in fixed-point units).
+    float invArea;
+    // The vertices of the triangle.
+    uint32_t i0, i1, i2;
+    // Screen space bounds of the triangle clamped to the image (inclusive).
+    int minX, minY, maxX, maxY;
+};
+
+// Rasterize the rows [y0...y1] of a triangle.
+template<PixelShader Shader>
+void rasterizeTriangleRows( ImageView& dst, const TriangleSetup& t, std::span<const Vertex> vertices, const Shader& shader, int y0, int y1 ) noexcept
+{
+    const Vertex& v0 = vertices[t.i0];
+    const Vertex& v1 = vertices[t.i1];
+    const Vertex& v2 = vertices[t.i2];
+
+    // Step sizes of the edge functions for one pixel.
+    const int64_t stepX0 = t.e0.A * SubPixelScale, stepY0 = t.e0.B * SubPixelScale;
+    const int64_t stepX1 = t.e1.A * SubPixelScale, stepY1 = t.e1.B * SubPixelScale;
+    const int64_t stepX2 = t.e2.A * SubPixelScale, stepY2 = t.e2.B * SubPixelScale;
+
+    const int64_t px = static_cast<int64_t>( t.minX ) * SubPixelScale;
+    const int64_t py = static_cast<int64_t>( y0 ) * SubPixelScale;
+
+    int64_t row0 = t.e0( px, py );
+    int64_t row1 = t.e1( px, py );
+    int64_t row2 = t.e2( px, py );
+
+    ShaderInput input;
+
+    for ( int y = y0; y <= y1; ++y, row0 += stepY0, row1 += stepY1, row2 += stepY2 )
+    {
+        int64_t w0 = row0;
+        int64_t w1 = row1;
+        int64_t w2 = row2;
+
+        Color* row = &dst( 0, y );
+        input.y    = y;
+
+        for ( int x = t.minX; x <= t.maxX; ++x, w0 += stepX0, w1 += stepX1, w2 += stepX2 )
+        {
+            if ( ( w0 + t.e0.bias ) < 0 || ( w1 + t.e1.bias ) < 0 || ( w2 + t.e2.bias ) < 0 )
+                continue;
+
+            const float b0 = static_cast<float>( w0 ) * t.invArea;
+            const float b1 = static_cast<float>( w1 ) * t.invArea;
+            const float b2 = 1.0f - b0 - b1;
+
+            input.texCoord = v0.texCoord * b0 + v1.texCoord * b1 + v2.texCoord * b2;
+            input.color    = v0.color * b0 + v1.color * b1 + v2.color * b2;
+            input.dst      = row[x];
+            input.x        = x;
+
+            row[x] = shader( input );
+        }
+    }
+}
+}  // namespace detail
+
+template<PixelShader Shader>
+void ImageView::drawQuad( const Vertex& v0, const Vertex& v1, const Vertex& v2, const Vertex& v3, const Shader& shader )
+{
+    const Vertex verts[] = {
+        v0, v1, v2, v3
+    };
+
+    // Index buffer for the two triangles of the quad.
+    const uint32_t indicies[] = {
+        0, 1, 3,
+        1, 2, 3
+    };
+
+    drawTriangles( verts, indicies, shader );
+}
+
+template<PixelShader Shader>
+void ImageView::drawTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, const Shader& shader )
+{
+    std::vector<detail::TriangleSetup> triangles;
+    setupTriangles( vertices, indices, triangles );
+
+    if ( triangles.empty() )
+        return;
+
+    // Bin the triangles into horizontal bands.
+    const int numBands = ( static_cast<int>( m_height ) + detail::BandHeight - 1 ) / detail::BandHeight;
+
+    std::vector<uint32_t> bandOffsets;
+    std::vector<uint32_t> bandTriangles;
+    detail::binIntoBands( triangles, numBands, bandOffsets, bandTriangles );
+
+    // Render each band on a separate thread.
+#pragma omp parallel for schedule( dynamic )
+    for ( int b = 0; b < numBands; ++b )
+    {
+        const int bandMinY = b * detail::BandHeight;
+        const int bandMaxY = bandMinY + detail::BandHeight - 1;
+
+        for ( uint32_t i = bandOffsets[b]; i < bandOffsets[b + 1]; ++i )
+        {
+            const detail::TriangleSetup& t  = triangles[bandTriangles[i]];
+            const int                    y0 = std::max( t.minY, bandMinY );
+            const int                    y1 = std::min( t.maxY, bandMaxY );
+
+            detail::rasterizeTriangleRows( *this, t, vertices, shader, y0, y1 );
+        }
+    }
+}
+
+}  // namespace Graphics
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Config.hpp"
+#include "Image.hpp"
+#include "ImageView.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Graphics
+{
+/// <summary>
+/// Saves images on a background thread, so capturing screenshots or frame dumps does not stall the game loop.
+/// The pixels are copied into a pooled buffer when a save is queued, so the source image can be modified immediately.
+/// The queue is bounded: if the writer falls behind, new saves are dropped (or wait for a free slot).
+/// </summary>
+class SR_API ImageWriter final
+{
+public:
+    /// <summary>
+    /// Create an image writer.
+    /// </summary>
+    /// <param name="maxQueued">(optional) The maximum number of images that can be waiting to be written. Default: 4.</param>
+    explicit ImageWriter( size_t maxQueued = 4u );
+
+    /// <summary>
+    /// Finish writing the queued images and stop the worker thread.
+    /// </summary>
+    ~ImageWriter();
+
+    ImageWriter( const ImageWriter& )            = delete;
+    ImageWriter( ImageWriter&& )                 = delete;
+    ImageWriter& operator=( const ImageWriter& ) = delete;
+    ImageWriter& operator=( ImageWriter&& )      = delete;
+
+    /// <summary>
+    /// Get the image writer that is shared by the application.
+    /// </summary>
+    /// <returns>The shared image writer.</returns>
+    static ImageWriter& getShared();
+
+    /// <summary>
+    /// Queue an image to be saved to disk.
+    /// The file format is chosen by the extension of the file (see Image::save). QOI is recommended for frame dumps.
+    /// </summary>
+    /// <param name="image">The image to save. The pixels are copied before this function returns.</param>
+    /// <param name="file">The file to save the image to.</param>
+    /// <param name="wait">(optional) Wait for a free slot if the queue is full. Default: `false` (drop the image).</param>
+    /// <returns>`true` if the image was queued, or `false` if it was dropped.</returns>
+    bool save( const ImageView& image, const std::filesystem::path& file, bool wait = false );
+
+    /// <summary>
+    /// Block until all of the queued images have been written.
+    /// </summary>
+    void flush();
+
+    /// <summary>
+    /// Get the number of images that are queued or being written.
+    /// </summary>
+    /// <returns>The number of unfinished saves.</returns>
+    size_t getNumQueued() const;
+
+private:
+    struct Request
+    {
+        Image                 image;
+        std::filesystem::path file;
+    };
+
+    void worker();
+
+    std::deque<Request> queue;
+    std::vector<Image>  pool;  // Buffers of finished requests, so frame dumps don't allocate every frame.
+
+    mutable std::mutex      mutex;
+    std::condition_variable requestAvailable;
+    std::condition_variable requestFinished;
+
+    size_t maxQueued;
+    size_t writing = 0u;  // The number of images that are currently being written.
+    bool   stop    = false;
+
+    std::thread thread;
+};
+}  // namespace Graphics
@@ -1,173 +1,323 @@
-#pragma once
-
-#include "Config.hpp"
-#include "Events.hpp"
-#include "GamePadStateTracker.hpp"
-#include "KeyboardStateTracker.hpp"
-#include "MouseStateTracker.hpp"
-
-#include <functional>
-#include <span>
-#include <string_view>
-
-namespace Graphics
-{
-/// <summary>
-/// An AxisCallback function takes a GamePadStateTracker (for each connected GamePad), KeyboardStateTracker, and a MouseStateTracker and returns
-/// the value of the axis being queried (in the range [-1...1]).
-/// </summary>
-using AxisCallback = std::function<float(std::span<const GamePadStateTracker>, const KeyboardStateTracker&, const MouseStateTracker&)>;
-
-/// <summary>
-/// A ButtonCallback function takes a GamePadStateTracker (for each connected GamePad), a KeyboardStateTracker, and a MouseStateTracker and returns
-/// the state of the button.
-/// </summary>
-using ButtonCallback = std::function<bool(std::span<const GamePadStateTracker>, const KeyboardStateTracker&, const MouseStateTracker&)>;
-
-/// <summary>
-/// A KeyCallback function takes a KeyboardStateTracker and returns the key state.
-/// </summary>
-using KeyCallback = std::function<bool(const KeyboardStateTracker&)>;
-
-/// <summary>
-/// A MouseButtonCallback takes a MouseStateTracker and returns the state of the mouse button.
-/// </summary>
-using MouseButtonCallback = std::function<bool(MouseStateTracker&)>;
-
-class SR_API Input
-{
-public:
-    /// <summary>
-    /// Update the input state. Should only be called once per frame.
-    /// </summary>
-    static void update();
-
-    /// <summary>
-    /// Returns the value of the axis identified by axisName.
-    /// </summary>
-    /// <param name="axisName"></param>
-    /// <returns>A value in the range [-1...1] that represents the value of the axis.</returns>
-    static float getAxis( std::string_view axisName );
-
-    /// <summary>
-    /// Returns the value of the button identified by buttonName.
-    /// </summary>
-    /// <param name="buttonName">The name of the button to query.</param>
-    /// <returns>`true` if the button is pressed, `false` otherwise.</returns>
-    static bool getButton( std::string_view buttonName );
-
-    /// <summary>
-    /// Returns `true` in the frame that the button is pressed.
-    /// </summary>
-    /// <param name="buttonName">The name of the button to query.</param>
-    /// <returns>`true` if the button was pressed this frame, `false` otherwise.</returns>
-    static bool getButtonDown( std::string_view buttonName );
-
-    /// <summary>
-    /// Returns `true` in the frame that the button is released.
-    /// </summary>
-    /// <param name="buttonName">The name of the button to query.</param>
-    /// <returns>`true` if the button was released this frame, `false` otherwise.</returns>
-    static bool getButtonUp( std::string_view buttonName );
-
-    /// <summary>
-    /// Returns `true` while the user is holding down a specific key on the keyboard.
-    /// </summary>
-    /// <param name="keyName">The name of the key to query.</param>
-    /// <returns>`true` if the key is being held, `false` otherwise.</returns>
-    static bool getKey( std::string_view keyName );
-
-    /// <summary>
-    /// Returns `true` in the frame that the key is pressed.
-    /// </summary>
-    /// <param name="keyName">The name of the key to query.</param>
-    /// <returns>`true` if the key is pressed this frame, `false` otherwise.</returns>
-    static bool getKeyDown( std::string_view keyName );
-
-    /// <summary>
-    /// Return `true` in the frame that the key is released.
-    /// </summary>
-    /// <param name="keyName">The name of the key to query.</param>
-    /// <returns>`true` if the key is released this frame.</returns>
-    static bool getKeyUp( std::string_view keyName );
-
-    /// <summary>
-    /// Returns `true` while the user is holding down a specific key on the keyboard.
-    /// </summary>
-    /// <param name="key">The KeyCode enum to query.</param>
-    /// <returns>`true` if the key is being held, `false` otherwise.</returns>
-    static bool getKey( KeyCode key );
-
-    /// <summary>
-    /// Returns `true` in the frame that the key is pressed.
-    /// </summary>
-    /// <param name="key">The KeyCode enum to query.</param>
-    /// <returns>`true` if the key is pressed this frame, `false` otherwise.</returns>
-    static bool getKeyDown( KeyCode key );
-
-    /// <summary>
-    /// Returns `true` in the frame that the key is released.
-    /// </summary>
-    /// <param name="key">The KeyCode enum to query.</param>
-    /// <returns></returns>
-    static bool getKeyUp( KeyCode key );
-
-    /// <summary>
-    /// Returns true when the given mouse button is held down.
-    /// </summary>
-    /// <param name="button">The MouseButton enum to check.</param>
-    /// <returns>`true` if the mouse button is pressed, `false` otherwise.</returns>
-    static bool getMouseButton( MouseButton button );
-
-    /// <summary>
-    /// Returns true when the given mouse button is pressed this frame.
-    /// </summary>
-    /// <param name="button">The MouseButton enum to check.</param>
-    /// <returns>`true` if the mouse button is pressed this frame, `false` otherwise.</returns>
-    static bool getMouseButtonDown( MouseButton button );
-
-    /// <summary>
-    /// Returns true when the give mouse button is released this frame.
-    /// </summary>
-    /// <param name="button">The MouseButton enum to check.</param>
-    /// <returns>`true` if the mouse button is released this frame.</returns>
-    static bool getMouseButtonUp( MouseButton button );
-
-    /// <summary>
-    /// Map an axis name to an axis callback function.
-    /// </summary>
-    /// <param name="axisName">The name of the axis to map.</param>
-    /// <param name="callback">The callback function to use to return the value of the axis.</param>
-    static void mapAxis( std::string_view axisName, AxisCallback callback );
-
-    /// <summary>
-    /// Map a button name to a button callback function.
-    /// </summary>
-    /// <param name="buttonName"></param>
-    /// <param name="callback"></param>
-    static void mapButton( std::string_view buttonName, ButtonCallback callback );
-
-    /// <summary>
-    /// Map a button name to a button callback function.
-    /// </summary>
-    /// <param name="buttonName">The button to map to the callback function.</param>
-    /// <param name="callback">The callback function.</param>
-    static void mapButtonDown( std::string_view buttonName, ButtonCallback callback );
-
-    /// <summary>
-    /// Map a button name to a button callback function.
-    /// </summary>
-    /// <param name="buttonName">The button name to map to the callback function.</param>
-    /// <param name="callback">The callback function./param>
-    static void mapButtonUp( std::string_view buttonName, ButtonCallback callback );
-    
-    // Static class, delete constructors and assignment operators.
-    Input()                    = delete;
-    ~Input()                   = delete;
-    Input( const Input& )      = delete;
-    Input( Input && ) noexcept = delete;
-
-    Input& operator=( const Input& ) = delete;
-    Input& operator=( Input&& )      = delete;
-};
-}  // namespace Graphics
+#pragma once
+
+#include "Config.hpp"
+#include "Events.hpp"
+#include "GamePadStateTracker.hpp"
+#include "KeyboardStateTracker.hpp"
+#include "MouseStateTracker.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace Graphics
+{
+/// <summary>
+/// An AxisCallback function takes a GamePadStateTracker (for each connected GamePad), KeyboardStateTracker, and a MouseStateTracker and returns
+/// the value of the axis being queried (in the range [-1...1]).
+/// </summary>
+using AxisCallback = std::function<float(std::span<const GamePadStateTracker>, const KeyboardStateTracker&, const MouseStateTracker&)>;
+
+/// <summary>
+/// A ButtonCallback function takes a GamePadStateTracker (for each connected GamePad), a KeyboardStateTracker, and a MouseStateTracker and returns
+/// the state of the button.
+/// </summary>
+using ButtonCallback = std::function<bool(std::span<const GamePadStateTracker>, const KeyboardStateTracker&, const MouseStateTracker&)>;
+
+/// <summary>
+/// A KeyCallback function takes a KeyboardStateTracker and returns the key state.
+/// </summary>
+using KeyCallback = std::function<bool(const KeyboardStateTracker&)>;
+
+/// <summary>
+/// A MouseButtonCallback takes a MouseStateTracker and returns the state of the mouse button.
+/// </summary>
+using MouseButtonCallback = std::function<bool(MouseStateTracker&)>;
+
+/// <summary>
+/// A handle to an input action (a mapped axis or button).
+/// Handles are returned by Input::mapAxis/Input::mapButton (or looked up by name with Input::getAxisHandle/Input::getButtonHandle)
+/// and are cheap to copy and store. The bindings of every action are evaluated once in Input::update, so querying an
+/// action by its handle is an array lookup (no string hashing, allocations, or callbacks).
+/// </summary>
+/// <typeparam name="T">The type of the value of the action.</typeparam>
+template<typename T>
+class ActionHandle final
+{
+public:
+    constexpr ActionHandle() noexcept = default;
+
+    /// <summary>
+    /// Check if the handle refers to an action.
+    /// </summary>
+    /// <returns>`true` if the action has a binding.</returns>
+    constexpr bool isValid() const noexcept
+    {
+        return index != InvalidIndex;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return isValid();
+    }
+
+    constexpr bool operator==( const ActionHandle& ) const noexcept = default;
+
+private:
+    friend class Input;
+
+    static constexpr uint32_t InvalidIndex = ~0u;
+
+    constexpr explicit ActionHandle( uint32_t index ) noexcept
+    : index { index }
+    {}
+
+    uint32_t index = InvalidIndex;  // The index of the action in the input state.
+};
+
+using AxisHandle   = ActionHandle<float>;
+using ButtonHandle = ActionHandle<bool>;
+
+class SR_API Input
+{
+public:
+    /// <summary>
+    /// Update the input state and evaluate the bindings of every action. Should only be called once per frame.
+    /// </summary>
+    static void update();
+
+    /// <summary>
+    /// Get the time between the last two updates (in seconds).
+    /// While a recording is replayed, this is the frame time that was recorded. Use this as the time step of the game to
+    /// make a replayed session reproduce the recorded session exactly, regardless of how fast the replay runs.
+    /// The frame time is never 0: the first update (and the first update after a replay stops) uses the previous frame
+    /// time, or 1/60 of a second if there is none.
+    /// </summary>
+    /// <returns>The frame time (in seconds).</returns>
+    static double getFrameTime() noexcept;
+
+    /// <summary>
+    /// Use a fixed frame time instead of measuring the time between updates.
+    /// A fixed time step makes the game update the same way regardless of how fast it runs. The fixed frame time is
+    /// written to recordings, so they are replayed with the same time step.
+    /// </summary>
+    /// <param name="seconds">The frame time (in seconds), or 0 to measure the frame time.</param>
+    static void setFixedFrameTime( double seconds ) noexcept;
+
+    /// <summary>
+    /// Record the keyboard, mouse, and gamepad states of every update to a file.
+    /// Only the states that change from one frame to the next are stored, so recordings stay small.
+    /// </summary>
+    /// <param name="file">The file to write the recording to.</param>
+    /// <returns>`true` if the file was created.</returns>
+    static bool startRecording( const std::filesystem::path& file );
+
+    /// <summary>
+    /// Stop recording and close the recording file.
+    /// </summary>
+    static void stopRecording();
+
+    static bool isRecording() noexcept;
+
+    /// <summary>
+    /// Replay a recording.
+    /// Each update reads the device states of the next recorded frame instead of the devices, until the end of the
+    /// recording is reached. No devices (or window) are needed while a recording is replayed.
+    /// </summary>
+    /// <param name="file">The recording to replay.</param>
+    /// <returns>`true` if the recording is valid.</returns>
+    static bool startReplay( const std::filesystem::path& file );
+
+    /// <summary>
+    /// Stop replaying and go back to reading the devices.
+    /// </summary>
+    static void stopReplay();
+
+    /// <summary>
+    /// Check if a recording is being replayed.
+    /// </summary>
+    /// <returns>`true` until the end of the recording is reached.</returns>
+    static bool isReplaying() noexcept;
+
+    /// <summary>
+    /// Get the handle of an axis.
+    /// Look up the handle once (for example, when a game object is created) and use it to query the axis every frame.
+    /// </summary>
+    /// <param name="axisName">The name of the axis.</param>
+    /// <returns>The handle of the axis, or an invalid handle if no axis with that name is mapped.</returns>
+    static AxisHandle getAxisHandle( std::string_view axisName );
+
+    /// <summary>
+    /// Get the handle of a button.
+    /// Buttons include the mapped buttons, the keys in the key map, and the mapped axes (which are pressed while the axis is positive).
+    /// </summary>
+    /// <param name="buttonName">The name of the button.</param>
+    /// <returns>The handle of the button, or an invalid handle if no button with that name is mapped.</returns>
+    static ButtonHandle getButtonHandle( std::string_view buttonName );
+
+    /// <summary>
+    /// Returns the value of an axis.
+    /// </summary>
+    /// <param name="axis">The handle of the axis.</param>
+    /// <returns>A value in the range [-1...1] that represents the value of the axis (0 if the handle is not valid).</returns>
+    static float getAxis( AxisHandle axis ) noexcept;
+
+    /// <summary>
+    /// Returns `true` while a button is held down.
+    /// </summary>
+    /// <param name="button">The handle of the button.</param>
+    /// <returns>`true` if the button is pressed, `false` otherwise.</returns>
+    static bool getButton( ButtonHandle button ) noexcept;
+
+    /// <summary>
+    /// Returns `true` in the frame that the button is pressed.
+    /// </summary>
+    /// <param name="button">The handle of the button.</param>
+    /// <returns>`true` if the button was pressed this frame, `false` otherwise.</returns>
+    static bool getButtonDown( ButtonHandle button ) noexcept;
+
+    /// <summary>
+    /// Returns `true` in the frame that the button is released.
+    /// </summary>
+    /// <param name="button">The handle of the button.</param>
+    /// <returns>`true` if the button was released this frame, `false` otherwise.</returns>
+    static bool getButtonUp( ButtonHandle button ) noexcept;
+
+    /// <summary>
+    /// Returns the value of the axis identified by axisName.
+    /// Prefer getAxis( AxisHandle ) for axes that are queried every frame.
+    /// </summary>
+    /// <param name="axisName"></param>
+    /// <returns>A value in the range [-1...1] that represents the value of the axis.</returns>
+    static float getAxis( std::string_view axisName );
+
+    /// <summary>
+    /// Returns the value of the button identified by buttonName.
+    /// </summary>
+    /// <param name="buttonName">The name of the button to query.</param>
+    /// <returns>`true` if the button is pressed, `false` otherwise.</returns>
+    static bool getButton( std::string_view buttonName );
+
+    /// <summary>
+    /// Returns `true` in the frame that the button is pressed.
+    /// </summary>
+    /// <param name="buttonName">The name of the button to query.</param>
+    /// <returns>`true` if the button was pressed this frame, `false` otherwise.</returns>
+    static bool getButtonDown( std::string_view buttonName );
+
+    /// <summary>
+    /// Returns `true` in the frame that the button is released.
+    /// </summary>
+    /// <param name="buttonName">The name of the button to query.</param>
+    /// <returns>`true` if the button was released this frame, `false` otherwise.</returns>
+    static bool getButtonUp( std::string_view buttonName );
+
+    /// <summary>
+    /// Returns `true` while the user is holding down a specific key on the keyboard.
+    /// </summary>
+    /// <param name="keyName">The name of the key to query.</param>
+    /// <returns>`true` if the key is being held, `false` otherwise.</returns>
+    static bool getKey( std::string_view keyName );
+
+    /// <summary>
+    /// Returns `true` in the frame that the key is pressed.
+    /// </summary>
+    /// <param name="keyName">The name of the key to query.</param>
+    /// <returns>`true` if the key is pressed this frame, `false` otherwise.</returns>
+    static bool getKeyDown( std::string_view keyName );
+
+    /// <summary>
+    /// Return `true` in the frame that the key is released.
+    /// </summary>
+    /// <param name="keyName">The name of the key to query.</param>
+    /// <returns>`true` if the key is released this frame.</returns>
+    static bool getKeyUp( std::string_view keyName );
+
+    /// <summary>
+    /// Returns `true` while the user is holding down a specific key on the keyboard.
+    /// </summary>
+    /// <param name="key">The KeyCode enum to query.</param>
+    /// <returns>`true` if the key is being held, `false` otherwise.</returns>
+    static bool getKey( KeyCode key );
+
+    /// <summary>
+    /// Returns `true` in the frame that the key is pressed.
+    /// </summary>
+    /// <param name="key">The KeyCode enum to query.</param>
+    /// <returns>`true` if the key is pressed this frame, `false` otherwise.</returns>
+    static bool getKeyDown( KeyCode key );
+
+    /// <summary>
+    /// Returns `true` in the frame that the key is released.
+    /// </summary>
+    /// <param name="key">The KeyCode enum to query.</param>
+    /// <returns></returns>
+    static bool getKeyUp( KeyCode key );
+
+    /// <summary>
+    /// Returns true when the given mouse button is held down.
+    /// </summary>
+    /// <param name="button">The MouseButton enum to check.</param>
+    /// <returns>`true` if the mouse button is pressed, `false` otherwise.</returns>
+    static bool getMouseButton( MouseButton button );
+
+    /// <summary>
+    /// Returns true when the given mouse button is pressed this frame.
+    /// </summary>
+    /// <param name="button">The MouseButton enum to check.</param>
+    /// <returns>`true` if the mouse button is pressed this frame, `false` otherwise.</returns>
+    static bool getMouseButtonDown( MouseButton button );
+
+    /// <summary>
+    /// Returns true when the give mouse button is released this frame.
+    /// </summary>
+    /// <param name="button">The MouseButton enum to check.</param>
+    /// <returns>`true` if the mouse button is released this frame.</returns>
+    static bool getMouseButtonUp( MouseButton button );
+
+    /// <summary>
+    /// Map an axis name to an axis callback function.
+    /// The callback is called once per frame in Input::update.
+    /// </summary>
+    /// <param name="axisName">The name of the axis to map.</param>
+    /// <param name="callback">The callback function to use to return the value of the axis.</param>
+    /// <returns>The handle of the axis.</returns>
+    static AxisHandle mapAxis( std::string_view axisName, AxisCallback callback );
+
+    /// <summary>
+    /// Map a button name to a button callback function.
+    /// The callback is called once per frame in Input::update.
+    /// </summary>
+    /// <param name="buttonName">The button to map to the callback function.</param>
+    /// <param name="callback">The callback function that returns `true` while the button is held.</param>
+    /// <returns>The handle of the button.</returns>
+    static ButtonHandle mapButton( std::string_view buttonName, ButtonCallback callback );
+
+    /// <summary>
+    /// Map a button name to a button callback function.
+    /// </summary>
+    /// <param name="buttonName">The button to map to the callback function.</param>
+    /// <param name="callback">The callback function that returns `true` in the frame that the button is pressed.</param>
+    /// <returns>The handle of the button.</returns>
+    static ButtonHandle mapButtonDown( std::string_view buttonName, ButtonCallback callback );
+
+    /// <summary>
+    /// Map a button name to a button callback function.
+    /// </summary>
+    /// <param name="buttonName">The button name to map to the callback function.</param>
+    /// <param name="callback">The callback function that returns `true` in the frame that the button is released.</param>
+    /// <returns>The handle of the button.</returns>
+    static ButtonHandle mapButtonUp( std::string_view buttonName, ButtonCallback callback );
+    
+    // Static class, delete constructors and assignment operators.
+    Input()                    = delete;
+    ~Input()                   = delete;
+    Input( const Input& )      = delete;
+    Input( Input && ) noexcept = delete;
+
+    Input& operator=( const Input& ) = delete;
+    Input& operator=( Input&& )      = delete;
+};
+}  // namespace Graphics
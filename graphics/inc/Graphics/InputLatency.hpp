@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Graphics
+{
+class ImageView;
+
+/// <summary>
+/// Measures the time from when input is received until the frame that consumed it is presented.
+/// The platform layer reports when keyboard and mouse input arrives, Input::update tags the frame with the oldest input
+/// it consumed, and Window::present records the latency of that frame. Frames that consumed no input are not measured.
+/// The latencies of the last MaxSamples measured frames are kept in a rolling histogram.
+/// Game pads are polled by Input::update, so they are not measured.
+/// </summary>
+class SR_API InputLatency
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// The number of frames the histogram and the statistics are computed over.
+    /// </summary>
+    static constexpr size_t MaxSamples = 256;
+
+    /// <summary>
+    /// The number of buckets of the histogram. The last bucket also counts all the latencies that don't fit in the histogram.
+    /// </summary>
+    static constexpr size_t NumBuckets = 50;
+
+    /// <summary>
+    /// The width of each bucket of the histogram (in milliseconds).
+    /// </summary>
+    static constexpr double BucketWidth = 1.0;
+
+    /// <summary>
+    /// Latency statistics (in milliseconds) of the measured frames.
+    /// </summary>
+    struct Stats
+    {
+        size_t count = 0u;  ///< The number of measured frames.
+        double min   = 0.0;
+        double mean  = 0.0;
+        double p50   = 0.0;
+        double p95   = 0.0;
+        double p99   = 0.0;
+        double max   = 0.0;
+    };
+
+    /// <summary>
+    /// Report that input was received. Only the oldest input that has not been consumed by Input::update is kept.
+    /// This is called by the platform layer and can be called from any thread.
+    /// </summary>
+    /// <param name="time">(optional) The time the input was received. Default: now.</param>
+    static void notifyInput( Clock::time_point time = Clock::now() ) noexcept;
+
+    /// <summary>
+    /// Tag the current frame with the oldest input that was received since the previous call.
+    /// This is called by Input::update when it reads the devices.
+    /// This and the rest of the functions below must only be called from the game thread.
+    /// </summary>
+    static void beginFrame() noexcept;
+
+    /// <summary>
+    /// Discard the input that was received since the previous call without measuring it.
+    /// This is called by Input::update while a recording is replayed (the devices are not read).
+    /// </summary>
+    static void discardInput() noexcept;
+
+    /// <summary>
+    /// Record the latency of the current frame (if it consumed any input).
+    /// This is called by Window::present.
+    /// </summary>
+    static void endFrame() noexcept;
+
+    /// <summary>
+    /// Clear the measured frames.
+    /// </summary>
+    static void reset() noexcept;
+
+    /// <summary>
+    /// Get the latency statistics of the last MaxSamples measured frames.
+    /// </summary>
+    static Stats getStats();
+
+    /// <summary>
+    /// Get the rolling histogram of the latencies. Bucket i counts the frames with a latency in the range
+    /// [i * BucketWidth, (i + 1) * BucketWidth) milliseconds.
+    /// </summary>
+    static std::span<const uint32_t, NumBuckets> getHistogram() noexcept;
+
+    /// <summary>
+    /// Draw the histogram and the statistics to an image.
+    /// </summary>
+    /// <param name="image">The image to draw to.</param>
+    /// <param name="x">The x-coordinate of the top-left corner of the overlay.</param>
+    /// <param name="y">The y-coordinate of the top-left corner of the overlay.</param>
+    static void drawOverlay( ImageView& image, int x, int y );
+
+    // Static class, delete constructors and assignment operators.
+    InputLatency()                          = delete;
+    ~InputLatency()                         = delete;
+    InputLatency( const InputLatency& )     = delete;
+    InputLatency( InputLatency&& ) noexcept = delete;
+
+    InputLatency& operator=( const InputLatency& ) = delete;
+    InputLatency& operator=( InputLatency&& )      = delete;
+};
+}  // namespace Graphics
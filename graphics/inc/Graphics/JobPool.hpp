@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Graphics
+{
+/// <summary>
+/// A fixed set of worker threads that run jobs in the order they are submitted.
+/// Used to load and decode resources in the background so the render thread does not stall.
+/// </summary>
+class SR_API JobPool final
+{
+public:
+    /// <summary>
+    /// Create a job pool.
+    /// </summary>
+    /// <param name="numThreads">(optional) The number of worker threads. Default: 0 (one less than the number of hardware threads, at least 1).</param>
+    explicit JobPool( uint32_t numThreads = 0u );
+
+    /// <summary>
+    /// Finish all of the queued jobs and stop the worker threads.
+    /// </summary>
+    ~JobPool();
+
+    JobPool( const JobPool& )            = delete;
+    JobPool( JobPool&& )                 = delete;
+    JobPool& operator=( const JobPool& ) = delete;
+    JobPool& operator=( JobPool&& )      = delete;
+
+    /// <summary>
+    /// Get the job pool that is shared by the resource manager and other systems.
+    /// </summary>
+    /// <returns>The shared job pool.</returns>
+    static JobPool& getShared();
+
+    /// <summary>
+    /// Queue a job to run on one of the worker threads.
+    /// </summary>
+    /// <param name="func">The function to run.</param>
+    /// <returns>A future that receives the result (or exception) of the job.</returns>
+    template<typename Func>
+    auto submit( Func&& func ) -> std::future<std::invoke_result_t<std::decay_t<Func>>>
+    {
+        using Result = std::invoke_result_t<std::decay_t<Func>>;
+
+        // std::function requires a copyable function object, but a packaged task can only be moved.
+        auto task   = std::make_shared<std::packaged_task<Result()>>( std::forward<Func>( func ) );
+        auto future = task->get_future();
+
+        enqueue( [task] { ( *task )(); } );
+
+        return future;
+    }
+
+    /// <summary>
+    /// Block until all of the queued jobs have finished.
+    /// </summary>
+    void wait();
+
+    /// <summary>
+    /// Get the number of jobs that are queued or running.
+    /// </summary>
+    /// <returns>The number of unfinished jobs.</returns>
+    size_t getNumPending() const;
+
+    /// <summary>
+    /// Get the number of worker threads.
+    /// </summary>
+    /// <returns>The number of worker threads in the pool.</returns>
+    size_t getNumThreads() const noexcept
+    {
+        return threads.size();
+    }
+
+private:
+    void enqueue( std::function<void()> job );
+    void worker();
+
+    std::vector<std::thread>          threads;
+    std::deque<std::function<void()>> jobs;
+
+    mutable std::mutex      mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsFinished;
+
+    // The number of jobs that are currently running.
+    size_t running = 0u;
+    bool   stop    = false;
+};
+}  // namespace Graphics
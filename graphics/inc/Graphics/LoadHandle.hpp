@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <utility>
+
+namespace Graphics
+{
+/// <summary>
+/// A handle to a resource that is being loaded in the background.
+/// Until the resource is ready, `get` returns the placeholder (if one was provided),
+/// so the handle can be used for drawing every frame without blocking.
+/// Handles are cheap to copy and all copies refer to the same resource.
+/// </summary>
+/// <typeparam name="T">The type of resource being loaded.</typeparam>
+template<typename T>
+class LoadHandle
+{
+public:
+    LoadHandle() = default;
+
+    /// <summary>
+    /// Create a handle from the result of a background job.
+    /// </summary>
+    /// <param name="future">The future that receives the loaded resource.</param>
+    /// <param name="placeholder">(optional) The resource to use until the resource is ready. Default: nullptr.</param>
+    explicit LoadHandle( std::shared_future<std::shared_ptr<T>> future, std::shared_ptr<T> placeholder = nullptr )
+    : future { std::move( future ) }
+    , placeholder { std::move( placeholder ) }
+    {}
+
+    /// <summary>
+    /// Check if the handle refers to a resource.
+    /// </summary>
+    /// <returns>`true` if the handle was returned by one of the asynchronous load functions.</returns>
+    bool isValid() const noexcept
+    {
+        return future.valid();
+    }
+
+    /// <summary>
+    /// Check if the resource has finished loading.
+    /// </summary>
+    /// <returns>`true` if `get` returns the loaded resource.</returns>
+    bool isReady() const
+    {
+        return future.valid() && future.wait_for( std::chrono::seconds { 0 } ) == std::future_status::ready;
+    }
+
+    /// <summary>
+    /// Get the resource without blocking.
+    /// </summary>
+    /// <returns>The loaded resource, or the placeholder if the resource is not ready yet.</returns>
+    std::shared_ptr<T> get() const
+    {
+        return isReady() ? future.get() : placeholder;
+    }
+
+    /// <summary>
+    /// Block until the resource has finished loading.
+    /// </summary>
+    /// <returns>The loaded resource.</returns>
+    std::shared_ptr<T> wait() const
+    {
+        return future.valid() ? future.get() : placeholder;
+    }
+
+    /// <summary>
+    /// Get the placeholder resource.
+    /// </summary>
+    /// <returns>The resource that is used until the resource is ready.</returns>
+    const std::shared_ptr<T>& getPlaceholder() const noexcept
+    {
+        return placeholder;
+    }
+
+    /// <summary>
+    /// Check if the resource has finished loading.
+    /// </summary>
+    explicit operator bool() const
+    {
+        return isReady();
+    }
+
+private:
+    std::shared_future<std::shared_ptr<T>> future;
+    std::shared_ptr<T>                     placeholder;
+};
+}  // namespace Graphics
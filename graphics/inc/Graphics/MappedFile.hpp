@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <streambuf>
+
+namespace Graphics
+{
+/// <summary>
+/// A file that is mapped into memory.
+/// The contents of the file are paged in by the operating system when they are first accessed, so the file doesn't need
+/// to be read into a separate buffer. The file is unmapped when the MappedFile is destroyed.
+/// </summary>
+class SR_API MappedFile final
+{
+public:
+    /// <summary>
+    /// How the memory of the mapped file can be accessed.
+    /// </summary>
+    enum class Access
+    {
+        ReadOnly,     ///< The mapped memory can only be read.
+        CopyOnWrite,  ///< The mapped memory can be written to. Written pages are copied and never written back to the file.
+    };
+
+    MappedFile() = default;
+
+    /// <summary>
+    /// Map a file into memory.
+    /// Use operator bool to check if the file was mapped (files that don't exist or are empty can't be mapped).
+    /// </summary>
+    /// <param name="path">The path to the file to map.</param>
+    /// <param name="access">(optional) How the mapped memory can be accessed. Default: Access::ReadOnly.</param>
+    explicit MappedFile( const std::filesystem::path& path, Access access = Access::ReadOnly );
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile( MappedFile&& other ) noexcept;
+    ~MappedFile();
+    MappedFile& operator=( const MappedFile& ) = delete;
+    MappedFile& operator=( MappedFile&& other ) noexcept;
+
+    /// <summary>
+    /// Get a pointer to the mapped memory.
+    /// Only write to the memory of a file that was mapped with Access::CopyOnWrite.
+    /// </summary>
+    std::byte* data() noexcept
+    {
+        return fileData;
+    }
+
+    const std::byte* data() const noexcept
+    {
+        return fileData;
+    }
+
+    /// <summary>
+    /// Get the size of the mapped file (in bytes).
+    /// </summary>
+    size_t size() const noexcept
+    {
+        return fileSize;
+    }
+
+    bool empty() const noexcept
+    {
+        return fileSize == 0u;
+    }
+
+    /// <summary>
+    /// Get the contents of the mapped file.
+    /// </summary>
+    std::span<const std::byte> getData() const noexcept
+    {
+        return { fileData, fileSize };
+    }
+
+    /// <summary>
+    /// Check if the file is mapped.
+    /// </summary>
+    explicit operator bool() const noexcept
+    {
+        return fileData != nullptr;
+    }
+
+private:
+    void unmap() noexcept;
+
+    std::byte* fileData = nullptr;
+    size_t     fileSize = 0u;
+
+#if defined( _WIN32 )
+    void* fileHandle    = nullptr;  // HANDLE
+    void* mappingHandle = nullptr;  // HANDLE
+#else
+    int fd = -1;
+#endif
+};
+
+/// <summary>
+/// A read-only stream buffer over a memory-mapped file.
+/// Use this to pass a mapped file to libraries that read from a std::istream (for example, the LDtk loader) without
+/// reading the file into memory first.
+/// </summary>
+class MappedFileBuffer final : public std::streambuf
+{
+public:
+    explicit MappedFileBuffer( MappedFile mappedFile )
+    : file { std::move( mappedFile ) }
+    {
+        // The get area is never written to by std::streambuf.
+        auto* begin = const_cast<char*>( reinterpret_cast<const char*>( file.data() ) );
+        setg( begin, begin, begin + file.size() );
+    }
+
+private:
+    MappedFile file;
+};
+
+}  // namespace Graphics
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Config.hpp"
+#include "SpriteInstance.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Graphics
+{
+class ImageView;
+class SpriteSheet;
+
+/// <summary>
+/// A queue of sprite draws that are sorted before they are rendered.
+/// Each draw is assigned a 64-bit sort key composed of (from most to least significant bits):
+///   * The layer (8 bits).
+///   * The depth (32 bits). For top-down games, use the y-coordinate of the sprite's feet to y-sort.
+///   * The sprite sheet (24 bits).
+/// Draws are sorted with a stable LSD radix sort, so draws with the same key are rendered in
+/// submission order and the cost of sorting is linear in the number of draws.
+/// Consecutive draws from the same sprite sheet are submitted with a single call to ImageView::drawSprites.
+/// </summary>
+class SR_API RenderQueue final
+{
+public:
+    RenderQueue()  = default;
+    ~RenderQueue() = default;
+
+    RenderQueue( const RenderQueue& )                = default;
+    RenderQueue( RenderQueue&& ) noexcept            = default;
+    RenderQueue& operator=( const RenderQueue& )     = default;
+    RenderQueue& operator=( RenderQueue&& ) noexcept = default;
+
+    /// <summary>
+    /// Add a sprite to the queue.
+    /// Note: The sprite sheet must remain valid until the queue is cleared.
+    /// </summary>
+    /// <param name="sheet">The sprite sheet that contains the sprite.</param>
+    /// <param name="instance">The sprite instance to draw.</param>
+    /// <param name="layer">(optional) The layer to draw the sprite on. Lower layers are drawn first. Default: 0.</param>
+    /// <param name="depth">(optional) The depth of the sprite in the layer. Lower depths are drawn first. Default: 0.</param>
+    void submit( const SpriteSheet& sheet, const SpriteInstance& instance, uint8_t layer = 0u, float depth = 0.0f );
+
+    /// <summary>
+    /// Sort the queued sprites and draw them to the image.
+    /// The queue is not cleared after drawing.
+    /// </summary>
+    /// <param name="image">The image to draw the sprites to.</param>
+    void draw( ImageView& image );
+
+    /// <summary>
+    /// Remove all sprites from the queue.
+    /// Memory allocated by the queue is kept for the next frame.
+    /// </summary>
+    void clear() noexcept;
+
+    /// <summary>
+    /// Get the number of sprites in the queue.
+    /// </summary>
+    /// <returns>The number of sprites in the queue.</returns>
+    size_t size() const noexcept
+    {
+        return keys.size();
+    }
+
+    /// <summary>
+    /// Check if the queue is empty.
+    /// </summary>
+    /// <returns>`true` if there are no sprites in the queue.</returns>
+    bool empty() const noexcept
+    {
+        return keys.empty();
+    }
+
+    /// <summary>
+    /// Compute the sort key for a draw.
+    /// </summary>
+    /// <param name="layer">The layer of the draw.</param>
+    /// <param name="depth">The depth of the draw in the layer.</param>
+    /// <param name="sheetId">The sprite sheet index (only the lower 24 bits are used).</param>
+    /// <returns>The 64-bit sort key.</returns>
+    static uint64_t makeKey( uint8_t layer, float depth, uint32_t sheetId ) noexcept;
+
+private:
+    // Get the index of the sprite sheet in the sheets array (adding it if necessary).
+    uint32_t getSheetId( const SpriteSheet& sheet );
+
+    // Sort the draw order by key.
+    void sort();
+
+    // The sprite sheets referenced by the queued draws.
+    std::vector<const SpriteSheet*> sheets;
+
+    // Sort keys and instances of the queued draws.
+    std::vector<uint64_t>       keys;
+    std::vector<SpriteInstance> instances;
+
+    // The sorted draw order (and the scratch buffers used by the radix sort).
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> scratch;
+    std::vector<uint64_t> sortedKeys;
+    std::vector<uint64_t> scratchKeys;
+
+    // Instances of a single sprite sheet in sorted order.
+    std::vector<SpriteInstance> batch;
+
+    // The index of the last sprite sheet that was looked up.
+    uint32_t lastSheetId = 0u;
+};
+}  // namespace Graphics
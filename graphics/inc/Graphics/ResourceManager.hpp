@@ -1,60 +1,317 @@
-#pragma once
-
-#include "Config.hpp"
-#include "Font.hpp"
-#include "Image.hpp"
-#include "SpriteSheet.hpp"
-
-#include <filesystem>
-#include <memory>
-
-namespace Graphics
-{
-class SR_API ResourceManager final
-{
-public:
-    /// <summary>
-    /// Load an image from a file.
-    /// </summary>
-    /// <param name="filePath">The path to the file to load.</param>
-    /// <returns>The loaded image.</returns>
-    static std::shared_ptr<Image> loadImage( const std::filesystem::path& filePath );
-
-    /// <summary>
-    /// Load a sprite sheet from a file.
-    /// </summary>
-    /// <param name="filePath">The file path to the image.</param>
-    /// <param name="spriteWidth">(optional) The width (in pixels) of a sprite in the sprite sheet. Default: image width.</param>
-    /// <param name="spriteHeight">(optional) The height (in pixels) of a sprite in the sprite sheet. Default: image height.</param>
-    /// <param name="padding">(optional) The amount of space (in pixels) between each sprite in the sprite sheet. Default: 0.</param>
-    /// <param name="margin">(optional) The amount of space (in pixels) around the entire image. Default: 0.</param>
-    /// <param name="blendMode">(optional) The blend mode to use when rendering the sprites in this sprite sheet. Default: No blending.</param>
-    /// <returns>The loaded SpriteSheet.</returns>
-    static std::shared_ptr<SpriteSheet> loadSpriteSheet( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth = {}, std::optional<uint32_t> spriteHeight = {}, uint32_t padding = 0u, uint32_t margin = 0u, const BlendMode& blendMode = {} );
-
-    /// <summary>
-    /// Load a font from a file.
-    /// </summary>
-    /// <param name="fontFile">The path to the font to load.</param>
-    /// <param name="size">(optional) The size of the font (in pixels). Default: 12</param>
-    /// <param name="firstChar">(optional) The first character in the font texture. Default: ' '.</param>
-    /// <param name="numChars">(optional) The number of characters in the font texture. Default: 96.</param>
-    /// <returns>A shared pointer to the loaded font.</returns>
-    static std::shared_ptr<Font> loadFont( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u );
-
-    /// <summary>
-    /// Unload all resources.
-    /// </summary>
-    static void clear();
-
-    // Singleton class.
-    ResourceManager()                         = delete;
-    ~ResourceManager()                        = delete;
-    ResourceManager( const ResourceManager& ) = delete;
-    ResourceManager( ResourceManager&& )      = delete;
-
-    ResourceManager& operator=( const ResourceManager& ) = delete;
-    ResourceManager& operator=( ResourceManager&& )      = delete;
-};
-
-}  // namespace Graphics
+#pragma once
+
+#include "AssetHandle.hpp"
+#include "AssetPack.hpp"
+#include "Config.hpp"
+#include "Font.hpp"
+#include "Image.hpp"
+#include "LoadHandle.hpp"
+#include "SpriteSheet.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace Graphics
+{
+/// <summary>
+/// The categories of resources that are cached by the resource manager.
+/// Each category has its own memory budget.
+/// </summary>
+enum class ResourceCategory
+{
+    Image,
+    SpriteSheet,
+    Font,
+};
+
+/// <summary>
+/// The memory usage of a category of cached resources.
+/// </summary>
+struct ResourceUsage
+{
+    size_t numResources = 0u;  ///< The number of cached resources.
+    size_t numInUse     = 0u;  ///< The number of cached resources that are referenced outside of the cache.
+    size_t numPinned    = 0u;  ///< The number of pinned resources.
+    size_t bytes        = 0u;  ///< The memory used by the cached resources (in bytes).
+    size_t budget       = 0u;  ///< The memory budget (in bytes), or 0 if the category has no budget.
+};
+
+/// <summary>
+/// The contents of a file that is used in place, either from a mounted asset pack or from a memory-mapped file.
+/// </summary>
+struct FileData
+{
+    std::span<const std::byte>  data;     ///< The contents of the file.
+    std::shared_ptr<const void> storage;  ///< The owner of the data. The data stays valid as long as a reference to it is kept.
+};
+
+/// <summary>
+/// Loads and caches images, sprite sheets and fonts.
+/// Assets are interned by their AssetId the first time they are used. Game code can keep the handle of an asset
+/// (see `getImageHandle`, `getSpriteSheetHandle` and `getFontHandle`) instead of looking it up by path every time.
+/// </summary>
+class SR_API ResourceManager final
+{
+public:
+    /// <summary>
+    /// Get the handle of an image. The image is not loaded until the handle is used.
+    /// </summary>
+    /// <param name="filePath">The path to the image.</param>
+    /// <returns>The handle of the image.</returns>
+    static ImageHandle getImageHandle( const std::filesystem::path& filePath );
+
+    /// <summary>
+    /// Get the handle of a sprite sheet. The sprite sheet is not loaded until the handle is used.
+    /// Sprite sheets with the same image and parameters share the same handle (and SpriteSheet).
+    /// </summary>
+    /// <param name="filePath">The file path to the image.</param>
+    /// <param name="spriteWidth">(optional) The width (in pixels) of a sprite in the sprite sheet. Default: image width.</param>
+    /// <param name="spriteHeight">(optional) The height (in pixels) of a sprite in the sprite sheet. Default: image height.</param>
+    /// <param name="padding">(optional) The amount of space (in pixels) between each sprite in the sprite sheet. Default: 0.</param>
+    /// <param name="margin">(optional) The amount of space (in pixels) around the entire image. Default: 0.</param>
+    /// <param name="blendMode">(optional) The blend mode to use when rendering the sprites in this sprite sheet. Default: No blending.</param>
+    /// <returns>The handle of the sprite sheet.</returns>
+    static SheetHandle getSpriteSheetHandle( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth = {}, std::optional<uint32_t> spriteHeight = {}, uint32_t padding = 0u, uint32_t margin = 0u, const BlendMode& blendMode = {} );
+
+    /// <summary>
+    /// Get the handle of a font. The font is not loaded until the handle is used.
+    /// </summary>
+    /// <param name="fontFile">The path to the font.</param>
+    /// <param name="size">(optional) The size of the font (in pixels). Default: 12</param>
+    /// <param name="firstChar">(optional) The first character in the font texture. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters in the font texture. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. Default: Bitmap.</param>
+    /// <returns>The handle of the font.</returns>
+    static FontHandle getFontHandle( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap );
+
+    /// <summary>
+    /// Get the image of a handle, loading it if necessary.
+    /// </summary>
+    /// <param name="handle">The handle of the image.</param>
+    /// <returns>The image, or `nullptr` if the handle is not valid.</returns>
+    static std::shared_ptr<Image> get( ImageHandle handle );
+
+    /// <summary>
+    /// Get the sprite sheet of a handle, loading it if necessary.
+    /// </summary>
+    /// <param name="handle">The handle of the sprite sheet.</param>
+    /// <returns>The sprite sheet, or `nullptr` if the handle is not valid.</returns>
+    static std::shared_ptr<SpriteSheet> get( SheetHandle handle );
+
+    /// <summary>
+    /// Get the font of a handle, loading it if necessary.
+    /// </summary>
+    /// <param name="handle">The handle of the font.</param>
+    /// <returns>The font, or `nullptr` if the handle is not valid.</returns>
+    static std::shared_ptr<Font> get( FontHandle handle );
+
+    /// <summary>
+    /// Load an image from a file.
+    /// </summary>
+    /// <param name="filePath">The path to the file to load.</param>
+    /// <returns>The loaded image.</returns>
+    static std::shared_ptr<Image> loadImage( const std::filesystem::path& filePath );
+
+    /// <summary>
+    /// Load a sprite sheet from a file.
+    /// </summary>
+    /// <param name="filePath">The file path to the image.</param>
+    /// <param name="spriteWidth">(optional) The width (in pixels) of a sprite in the sprite sheet. Default: image width.</param>
+    /// <param name="spriteHeight">(optional) The height (in pixels) of a sprite in the sprite sheet. Default: image height.</param>
+    /// <param name="padding">(optional) The amount of space (in pixels) between each sprite in the sprite sheet. Default: 0.</param>
+    /// <param name="margin">(optional) The amount of space (in pixels) around the entire image. Default: 0.</param>
+    /// <param name="blendMode">(optional) The blend mode to use when rendering the sprites in this sprite sheet. Default: No blending.</param>
+    /// <returns>The loaded SpriteSheet (shared with other calls that use the same parameters).</returns>
+    static std::shared_ptr<SpriteSheet> loadSpriteSheet( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth = {}, std::optional<uint32_t> spriteHeight = {}, uint32_t padding = 0u, uint32_t margin = 0u, const BlendMode& blendMode = {} );
+
+    /// <summary>
+    /// Load a font from a file.
+    /// </summary>
+    /// <param name="fontFile">The path to the font to load.</param>
+    /// <param name="size">(optional) The size of the font (in pixels). Default: 12</param>
+    /// <param name="firstChar">(optional) The first character in the font texture. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters in the font texture. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. Default: Bitmap.</param>
+    /// <returns>A shared pointer to the loaded font.</returns>
+    static std::shared_ptr<Font> loadFont( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap );
+
+    /// <summary>
+    /// Load an image from a file on the shared job pool.
+    /// If the image is already loaded (or being loaded), the existing image is shared.
+    /// If the image fails to load, waiting on the handle rethrows the exception and the error is listed in the load report.
+    /// </summary>
+    /// <param name="filePath">The path to the file to load.</param>
+    /// <param name="placeholder">(optional) The image to use until the image has been decoded. Default: nullptr.</param>
+    /// <returns>A handle that becomes ready when the image has been decoded.</returns>
+    static LoadHandle<Image> loadImageAsync( const std::filesystem::path& filePath, std::shared_ptr<Image> placeholder = nullptr );
+
+    /// <summary>
+    /// Load a sprite sheet from a file on the shared job pool.
+    /// The sprite sheet is created after its image has been decoded, without blocking a worker thread while it waits.
+    /// </summary>
+    /// <param name="filePath">The file path to the image.</param>
+    /// <param name="spriteWidth">(optional) The width (in pixels) of a sprite in the sprite sheet. Default: image width.</param>
+    /// <param name="spriteHeight">(optional) The height (in pixels) of a sprite in the sprite sheet. Default: image height.</param>
+    /// <param name="padding">(optional) The amount of space (in pixels) between each sprite in the sprite sheet. Default: 0.</param>
+    /// <param name="margin">(optional) The amount of space (in pixels) around the entire image. Default: 0.</param>
+    /// <param name="blendMode">(optional) The blend mode to use when rendering the sprites in this sprite sheet. Default: No blending.</param>
+    /// <param name="placeholder">(optional) The sprite sheet to use until the image has been decoded. Default: nullptr.</param>
+    /// <returns>A handle that becomes ready when the sprite sheet has been loaded.</returns>
+    static LoadHandle<SpriteSheet> loadSpriteSheetAsync( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth = {}, std::optional<uint32_t> spriteHeight = {}, uint32_t padding = 0u, uint32_t margin = 0u, const BlendMode& blendMode = {}, std::shared_ptr<SpriteSheet> placeholder = nullptr );
+
+    /// <summary>
+    /// Load a font from a file on the shared job pool.
+    /// Since the glyph atlas can only be used on the render thread, glyphs are rasterized the first time they are drawn.
+    /// </summary>
+    /// <param name="fontFile">The path to the font to load.</param>
+    /// <param name="size">(optional) The size of the font (in pixels). Default: 12</param>
+    /// <param name="firstChar">(optional) The first character of the preloaded metrics. Default: ' '.</param>
+    /// <param name="numChars">(optional) The number of characters of the preloaded metrics. Default: 96.</param>
+    /// <param name="mode">(optional) How glyphs are stored in the glyph atlas. Default: Bitmap.</param>
+    /// <param name="placeholder">(optional) The font to use until the font has been loaded. Default: nullptr.</param>
+    /// <returns>A handle that becomes ready when the font has been loaded.</returns>
+    static LoadHandle<Font> loadFontAsync( const std::filesystem::path& fontFile, float size = 12.0f, uint32_t firstChar = 32u, uint32_t numChars = 96u, FontMode mode = FontMode::Bitmap, std::shared_ptr<Font> placeholder = nullptr );
+
+    /// <summary>
+    /// Mount an asset pack that was created by the AssetPacker tool.
+    /// Images, sprite sheets and fonts in mounted packs are loaded from the memory-mapped pack instead of from disk.
+    /// Images in the pack are not decoded or copied. Sprite sheets use the slicing parameters from the pack if no sprite size is given.
+    /// Packs that are mounted later take precedence over packs that were mounted earlier.
+    /// </summary>
+    /// <param name="packFile">The path to the asset pack.</param>
+    /// <returns>`true` if the pack was mounted, `false` if the pack could not be opened.</returns>
+    static bool mountPack( const std::filesystem::path& packFile );
+
+    /// <summary>
+    /// Unmount all asset packs.
+    /// Resources that were loaded from a pack remain valid (the pack stays mapped until they are released).
+    /// </summary>
+    static void unmountPacks();
+
+    /// <summary>
+    /// Start loading a list of images on the shared job pool (for example, all of the images referenced by a level).
+    /// Later calls to `loadImage` or `loadSpriteSheet` with the same paths wait for the background load instead of decoding the image again.
+    /// </summary>
+    /// <param name="filePaths">The images to load.</param>
+    static void prefetch( std::span<const std::filesystem::path> filePaths );
+
+    /// <summary>
+    /// Get the contents of a file that is not cached by the resource manager (for example, music).
+    /// The file is found in the mounted asset packs, or memory-mapped from disk if no pack contains it.
+    /// </summary>
+    /// <param name="filePath">The path to the file (the same path that was used in the asset manifest).</param>
+    /// <param name="type">(optional) The type of the asset in the asset packs. Default: AssetType::Data.</param>
+    /// <returns>The contents of the file. The data is empty if the file is not in a pack and can't be mapped.</returns>
+    static FileData mapFile( const std::filesystem::path& filePath, AssetType type = AssetType::Data );
+
+    /// <summary>
+    /// Get the number of images, sprite sheets and fonts that are still being loaded in the background.
+    /// Useful for displaying a progress bar on a loading screen.
+    /// </summary>
+    /// <returns>The number of pending asynchronous loads.</returns>
+    static size_t getNumPending();
+
+    /// <summary>
+    /// Block until all of the resources that are being loaded in the background have finished loading.
+    /// </summary>
+    static void wait();
+
+    /// <summary>
+    /// Set the memory budget of a category of resources.
+    /// When a resource is loaded and the category is over budget, the least recently used resources that are not
+    /// referenced outside of the cache (and not pinned) are evicted until the category is within budget again.
+    /// Resources that are still in use are never evicted, so the budget can be exceeded.
+    /// </summary>
+    /// <param name="category">The category of resources.</param>
+    /// <param name="bytes">The budget (in bytes), or 0 to disable eviction. Default: 0.</param>
+    static void setBudget( ResourceCategory category, size_t bytes );
+
+    /// <summary>
+    /// Get the memory usage of a category of resources.
+    /// </summary>
+    /// <param name="category">The category of resources.</param>
+    /// <returns>The number of cached resources and the memory they use.</returns>
+    static ResourceUsage getUsage( ResourceCategory category );
+
+    /// <summary>
+    /// Pin a cached image, so it is never evicted (for example, the UI or the player's sprite sheets).
+    /// </summary>
+    /// <param name="image">An image that was loaded by the resource manager.</param>
+    /// <param name="pinned">(optional) `false` to unpin the image. Default: true.</param>
+    static void pin( const std::shared_ptr<Image>& image, bool pinned = true );
+
+    /// <summary>
+    /// Pin a cached font, so it is never evicted.
+    /// </summary>
+    /// <param name="font">A font that was loaded by the resource manager.</param>
+    /// <param name="pinned">(optional) `false` to unpin the font. Default: true.</param>
+    static void pin( const std::shared_ptr<Font>& font, bool pinned = true );
+
+    /// <summary>
+    /// Pin an image, so it is never evicted once it is loaded.
+    /// </summary>
+    /// <param name="handle">The handle of the image.</param>
+    /// <param name="pinned">(optional) `false` to unpin the image. Default: true.</param>
+    static void pin( ImageHandle handle, bool pinned = true );
+
+    /// <summary>
+    /// Pin a sprite sheet (and therefore its image), so it is never evicted once it is loaded.
+    /// </summary>
+    /// <param name="handle">The handle of the sprite sheet.</param>
+    /// <param name="pinned">(optional) `false` to unpin the sprite sheet. Default: true.</param>
+    static void pin( SheetHandle handle, bool pinned = true );
+
+    /// <summary>
+    /// Pin a font, so it is never evicted once it is loaded.
+    /// </summary>
+    /// <param name="handle">The handle of the font.</param>
+    /// <param name="pinned">(optional) `false` to unpin the font. Default: true.</param>
+    static void pin( FontHandle handle, bool pinned = true );
+
+    /// <summary>
+    /// Evict the least recently used resources that are no longer in use until every category is within its budget.
+    /// </summary>
+    /// <returns>The number of bytes that were freed.</returns>
+    static size_t trim();
+
+    /// <summary>
+    /// Evict all resources that are no longer in use and are not pinned (for example, after unloading a level).
+    /// Unlike `clear`, resources that are still in use stay cached.
+    /// </summary>
+    /// <returns>The number of bytes that were freed.</returns>
+    static size_t purge();
+
+    /// <summary>
+    /// Get a report of the resources that are currently cached.
+    /// Lists the memory usage of each category, followed by each resource (most recently used first).
+    /// </summary>
+    /// <returns>The residency report.</returns>
+    static std::string getResidencyReport();
+
+    /// <summary>
+    /// Get a report of the time spent loading each asset (slowest first).
+    /// Includes assets that have been evicted, and counts every time an asset was loaded.
+    /// Assets whose last background load failed are listed with the error.
+    /// </summary>
+    /// <returns>The load-time report.</returns>
+    static std::string getLoadReport();
+
+    /// <summary>
+    /// Unload all resources.
+    /// Waits for pending asynchronous loads to finish first. Handles remain valid.
+    /// </summary>
+    static void clear();
+
+    // Singleton class.
+    ResourceManager()                         = delete;
+    ~ResourceManager()                        = delete;
+    ResourceManager( const ResourceManager& ) = delete;
+    ResourceManager( ResourceManager&& )      = delete;
+
+    ResourceManager& operator=( const ResourceManager& ) = delete;
+    ResourceManager& operator=( ResourceManager&& )      = delete;
+};
+
+}  // namespace Graphics
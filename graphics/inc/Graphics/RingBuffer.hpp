@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace Graphics
+{
+/// <summary>
+/// A fixed size, lock-free queue for passing values from one producer thread to one consumer thread.
+/// Only one thread may push and only one (possibly the same) thread may pop. Pushing to a full ring fails instead of
+/// blocking, so the producer never waits on the consumer.
+/// </summary>
+/// <typeparam name="T">The type of the values in the ring. Values are copied in and out of the ring.</typeparam>
+/// <typeparam name="Capacity">The number of values the ring can hold. Must be a power of two.</typeparam>
+template<typename T, size_t Capacity>
+class RingBuffer final
+{
+public:
+    static_assert( Capacity > 0 && ( Capacity & ( Capacity - 1 ) ) == 0, "The capacity of the ring must be a power of two." );
+    static_assert( std::is_trivially_copyable_v<T>, "Values in the ring must be trivially copyable." );
+
+    RingBuffer() = default;
+
+    RingBuffer( const RingBuffer& )            = delete;
+    RingBuffer( RingBuffer&& )                 = delete;
+    RingBuffer& operator=( const RingBuffer& ) = delete;
+    RingBuffer& operator=( RingBuffer&& )      = delete;
+
+    /// <summary>
+    /// Push a value to the back of the ring. Only call this from the producer thread.
+    /// </summary>
+    /// <param name="value">The value to push.</param>
+    /// <returns>`true` if the value was pushed, or `false` if the ring is full.</returns>
+    bool push( const T& value ) noexcept
+    {
+        const size_t tail = m_Tail.load( std::memory_order_relaxed );
+
+        if ( tail - m_CachedHead == Capacity )
+        {
+            // Only reload the consumer's index when the ring looks full.
+            m_CachedHead = m_Head.load( std::memory_order_acquire );
+            if ( tail - m_CachedHead == Capacity )
+            {
+                m_Dropped.fetch_add( 1u, std::memory_order_relaxed );
+                return false;
+            }
+        }
+
+        m_Values[tail & Mask] = value;
+        m_Tail.store( tail + 1u, std::memory_order_release );
+
+        return true;
+    }
+
+    /// <summary>
+    /// Pop a value from the front of the ring. Only call this from the consumer thread.
+    /// </summary>
+    /// <param name="value">Receives the value that was popped.</param>
+    /// <returns>`true` if a value was popped, or `false` if the ring is empty.</returns>
+    bool pop( T& value ) noexcept
+    {
+        const size_t head = m_Head.load( std::memory_order_relaxed );
+
+        if ( head == m_CachedTail )
+        {
+            // Only reload the producer's index when the ring looks empty.
+            m_CachedTail = m_Tail.load( std::memory_order_acquire );
+            if ( head == m_CachedTail )
+                return false;
+        }
+
+        value = m_Values[head & Mask];
+        m_Head.store( head + 1u, std::memory_order_release );
+
+        return true;
+    }
+
+    /// <summary>
+    /// Get the value at the front of the ring without popping it. Only call this from the consumer thread.
+    /// </summary>
+    /// <returns>A pointer to the value at the front of the ring, or `nullptr` if the ring is empty.</returns>
+    const T* front() noexcept
+    {
+        const size_t head = m_Head.load( std::memory_order_relaxed );
+
+        if ( head == m_CachedTail )
+        {
+            m_CachedTail = m_Tail.load( std::memory_order_acquire );
+            if ( head == m_CachedTail )
+                return nullptr;
+        }
+
+        return &m_Values[head & Mask];
+    }
+
+    /// <summary>
+    /// Check if the ring is empty.
+    /// The result is only a snapshot if it is called while the other thread is pushing or popping.
+    /// </summary>
+    bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+    /// <summary>
+    /// Get the number of values in the ring.
+    /// The result is only a snapshot if it is called while the other thread is pushing or popping.
+    /// </summary>
+    size_t size() const noexcept
+    {
+        const size_t head = m_Head.load( std::memory_order_acquire );
+        const size_t tail = m_Tail.load( std::memory_order_acquire );
+
+        return tail - head;
+    }
+
+    /// <summary>
+    /// Get the maximum number of values the ring can hold.
+    /// </summary>
+    static constexpr size_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    /// <summary>
+    /// Get the number of values that could not be pushed because the ring was full.
+    /// </summary>
+    size_t getDropped() const noexcept
+    {
+        return m_Dropped.load( std::memory_order_relaxed );
+    }
+
+private:
+    static constexpr size_t Mask = Capacity - 1;
+
+    // std::hardware_destructive_interference_size can differ between compiler settings, so the layout of the ring
+    // would not be stable across libraries.
+    static constexpr size_t CacheLineSize = 64;
+
+    // The consumer's and the producer's indices are kept on separate cache lines (together with the copy of the other
+    // thread's index they last saw) so that pushing and popping doesn't bounce a cache line between the two threads.
+    // The indices only ever increase; they are wrapped into the ring with Mask.
+    alignas( CacheLineSize ) std::atomic<size_t> m_Head { 0u };  ///< Written by the consumer.
+    size_t m_CachedTail = 0u;                                    ///< The consumer's copy of m_Tail.
+
+    alignas( CacheLineSize ) std::atomic<size_t> m_Tail { 0u };  ///< Written by the producer.
+    size_t              m_CachedHead = 0u;                       ///< The producer's copy of m_Head.
+    std::atomic<size_t> m_Dropped { 0u };
+
+    alignas( CacheLineSize ) std::array<T, Capacity> m_Values {};
+};
+}  // namespace Graphics
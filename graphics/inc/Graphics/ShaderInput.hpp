@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Color.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <type_traits>
+
+namespace Graphics
+{
+
+/// <summary>
+/// The input to a pixel shader.
+/// A pixel shader is any function object that can be invoked as:
+///
+///   Color shader( const ShaderInput& input ) const;
+///
+/// The shader is called once for every pixel that is covered by a primitive and
+/// the returned color is written to the destination pixel. Blending is the
+/// responsibility of the shader (see TextureShader for an example).
+/// </summary>
+struct ShaderInput
+{
+    /// <summary>
+    /// The interpolated (normalized) texture coordinate.
+    /// </summary>
+    glm::vec2 texCoord;
+
+    /// <summary>
+    /// The interpolated vertex color.
+    /// </summary>
+    Color color;
+
+    /// <summary>
+    /// The current color of the destination pixel.
+    /// </summary>
+    Color dst;
+
+    /// <summary>
+    /// The x-coordinate of the destination pixel.
+    /// </summary>
+    int x;
+
+    /// <summary>
+    /// The y-coordinate of the destination pixel.
+    /// </summary>
+    int y;
+};
+
+/// <summary>
+/// A pixel shader is a function object that returns the color of a pixel from a ShaderInput.
+/// </summary>
+template<typename T>
+concept PixelShader = std::is_invocable_r_v<Color, const T&, const ShaderInput&>;
+
+}  // namespace Graphics
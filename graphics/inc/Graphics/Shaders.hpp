@@ -0,0 +1,98 @@
+#pragma once
+
+#include "BlendMode.hpp"
+#include "Color.hpp"
+#include "Enums.hpp"
+#include "GlyphAtlas.hpp"
+#include "ImageView.hpp"
+#include "ShaderInput.hpp"
+
+#include <glm/common.hpp>
+
+namespace Graphics
+{
+
+/// <summary>
+/// The pixel shader used by the built-in textured primitives.
+/// Samples the texture, modulates it with the vertex color and blends the result with the destination.
+/// </summary>
+struct TextureShader
+{
+    Color operator()( const ShaderInput& input ) const noexcept
+    {
+        return blendMode.Blend( texture.sample( input.texCoord, addressMode ) * input.color, input.dst );
+    }
+
+    const ImageView& texture;
+    AddressMode      addressMode = AddressMode::Wrap;
+    BlendMode        blendMode;
+};
+
+/// <summary>
+/// A pixel shader that fills the primitive with the vertex color.
+/// </summary>
+struct ColorShader
+{
+    Color operator()( const ShaderInput& input ) const noexcept
+    {
+        return blendMode.Blend( input.color, input.dst );
+    }
+
+    BlendMode blendMode;
+};
+
+/// <summary>
+/// A pixel shader that mixes the sampled texture color with a flash color (for example, a white hit-flash).
+/// The alpha of the texture is preserved so the flash only affects the visible pixels of the texture.
+/// </summary>
+struct FlashShader
+{
+    Color operator()( const ShaderInput& input ) const noexcept
+    {
+        const Color c = texture.sample( input.texCoord, addressMode ) * input.color;
+        const Color f = c * ( 1.0f - amount ) + flashColor * amount;
+
+        return blendMode.Blend( f.withAlpha( c.a ), input.dst );
+    }
+
+    const ImageView& texture;
+    Color            flashColor { Color::White };
+    float            amount      = 1.0f;  // The amount of flash color to apply [0..1].
+    AddressMode      addressMode = AddressMode::Clamp;
+    BlendMode        blendMode { BlendMode::AlphaBlend };
+};
+
+/// <summary>
+/// A pixel shader that renders signed distance field glyphs from the glyph atlas.
+/// The distance to the edge of the glyph is converted to pixel coverage with a smoothstep over one pixel,
+/// so glyphs stay sharp at any scale. The glyph can optionally be surrounded by an outline.
+/// </summary>
+struct SDFShader
+{
+    Color operator()( const ShaderInput& input ) const noexcept
+    {
+        // The signed distance (in pixels) to the edge of the glyph (positive inside the glyph).
+        const float d = ( atlas.sample( input.texCoord ) - onEdge ) * distanceScale;
+
+        const float fill    = glm::smoothstep( -0.5f - softness, 0.5f + softness, d );
+        const float outline = outlineWidth > 0.0f ? glm::smoothstep( -0.5f - softness, 0.5f + softness, d + outlineWidth ) : fill;
+
+        const float alpha = ( static_cast<float>( input.color.a ) * fill + static_cast<float>( outlineColor.a ) * ( outline - fill ) ) / 255.0f;
+        if ( alpha <= 0.0f )
+            return input.dst;
+
+        // Without an outline, the glyph is drawn in the fill color. Otherwise, the fill color is mixed with the
+        // outline color by the fraction of the coverage that belongs to the outline.
+        const Color c = outlineWidth > 0.0f ? input.color * ( fill / outline ) + outlineColor * ( ( outline - fill ) / outline ) : input.color;
+
+        return BlendMode::AlphaBlend.Blend( c.withAlpha( std::min( alpha, 1.0f ) ), input.dst );
+    }
+
+    const GlyphAtlas& atlas;
+    float             onEdge        = 0.5f;  // The (normalized) atlas value on the edge of the glyph.
+    float             distanceScale = 1.0f;  // Converts (normalized) atlas values to pixels.
+    float             outlineWidth  = 0.0f;  // The width of the outline in pixels.
+    Color             outlineColor { Color::Black };
+    float             softness = 0.0f;  // Widens the edge (in pixels) for blurred shadows.
+};
+}  // namespace Graphics
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Color.hpp"
+
+#include <Math/bitmask_operators.hpp>
+
+#include <glm/mat3x3.hpp>
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+
+namespace Graphics
+{
+
+/// <summary>
+/// Flip flags that can be applied to a sprite instance.
+/// </summary>
+enum class SpriteFlip : uint32_t
+{
+    None       = 0,       ///< The sprite is not flipped.
+    Horizontal = 1 << 0,  ///< The sprite is mirrored in the x-axis.
+    Vertical   = 1 << 1,  ///< The sprite is mirrored in the y-axis.
+    Both       = Horizontal | Vertical,
+};
+
+/// <summary>
+/// Compact per-instance data for drawing many sprites from the same sprite sheet
+/// with a single call to ImageView::drawSprites.
+/// </summary>
+struct SpriteInstance
+{
+    SpriteInstance() = default;
+
+    /// <summary>
+    /// Create an instance that is drawn at a position without rotation or scale.
+    /// </summary>
+    /// <param name="spriteId">The index of the sprite in the sprite sheet.</param>
+    /// <param name="position">The top-left corner of the sprite on the screen.</param>
+    /// <param name="color">(optional) The tint color to apply to the sprite. Default: White.</param>
+    /// <param name="flip">(optional) The flip flags to apply to the sprite. Default: None.</param>
+    SpriteInstance( uint32_t spriteId, const glm::vec2& position, const Color& color = Color::White, SpriteFlip flip = SpriteFlip::None ) noexcept
+    : spriteId { spriteId }
+    , color { color }
+    , flip { flip }
+    {
+        transform[2] = { position, 1.0f };
+    }
+
+    /// <summary>
+    /// Create an instance that is drawn with an affine transform.
+    /// </summary>
+    /// <param name="spriteId">The index of the sprite in the sprite sheet.</param>
+    /// <param name="transform">The 3x3 matrix to apply to the sprite.</param>
+    /// <param name="color">(optional) The tint color to apply to the sprite. Default: White.</param>
+    /// <param name="flip">(optional) The flip flags to apply to the sprite. Default: None.</param>
+    SpriteInstance( uint32_t spriteId, const glm::mat3& transform, const Color& color = Color::White, SpriteFlip flip = SpriteFlip::None ) noexcept
+    : spriteId { spriteId }
+    , transform { transform }
+    , color { color }
+    , flip { flip }
+    {}
+
+    /// <summary>
+    /// The index of the sprite in the sprite sheet.
+    /// </summary>
+    uint32_t spriteId = 0u;
+
+    /// <summary>
+    /// The transform to apply to the sprite. If the top-left 2x2 part of the matrix is
+    /// identity, the sprite is blitted directly at the translation of the matrix.
+    /// </summary>
+    glm::mat3 transform { 1.0f };
+
+    /// <summary>
+    /// The tint color of the sprite. It is multiplied with the color of the sprite in the sprite sheet.
+    /// </summary>
+    Color color { Color::White };
+
+    /// <summary>
+    /// Flip flags for the sprite.
+    /// </summary>
+    SpriteFlip flip = SpriteFlip::None;
+};
+
+}  // namespace Graphics
+
+// Enable bitmask operators on SpriteFlip.
+template<>
+struct enable_bitmask_operators<Graphics::SpriteFlip>
+{
+    static constexpr bool enable = true;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include <Math/Rect.hpp>
+
+#include <cstdint>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Graphics
+{
+class Font;
+
+/// <summary>
+/// A single glyph in a text layout.
+/// </summary>
+struct Glyph
+{
+    /// <summary>
+    /// The rectangle of the glyph relative to the origin of the text.
+    /// </summary>
+    Math::RectI dst;
+
+    /// <summary>
+    /// The slot of the glyph in the glyph atlas.
+    /// </summary>
+    uint32_t slot = 0xFFFFFFFFu;
+
+    /// <summary>
+    /// The generation of the atlas slot when the text was shaped.
+    /// If the slot's generation changes, the glyph was evicted and the text must be shaped again.
+    /// </summary>
+    uint32_t generation = 0u;
+};
+
+/// <summary>
+/// A string of text that has been shaped using a font.
+/// Shaping decodes the UTF-8 string and computes the position of each glyph once, so text that does not
+/// change every frame (labels, scores, FPS counters) can be drawn without shaping the string again.
+/// Glyphs refer to slots in the shared glyph atlas. If one of the glyphs is evicted from the atlas,
+/// the text is shaped again the next time it is drawn.
+/// Draw the layout with ImageView::drawText.
+/// </summary>
+class SR_API TextLayout final
+{
+public:
+    TextLayout() = default;
+
+    /// <summary>
+    /// Shape the text using a font.
+    /// Note: The font must remain valid for the lifetime of the layout.
+    /// </summary>
+    /// <param name="font">The font to use to shape the text.</param>
+    /// <param name="text">The UTF-8 encoded text to shape.</param>
+    /// <param name="maxWidth">(optional) The width to wrap the text at. Default: 0 (no word wrap).</param>
+    TextLayout( const Font& font, std::string_view text, float maxWidth = 0.0f );
+
+    ~TextLayout() = default;
+
+    TextLayout( const TextLayout& )                = default;
+    TextLayout( TextLayout&& ) noexcept            = default;
+    TextLayout& operator=( const TextLayout& )     = default;
+    TextLayout& operator=( TextLayout&& ) noexcept = default;
+
+    /// <summary>
+    /// Change the font and text of the layout.
+    /// The text is only shaped again if the font, text or wrap width is different from the current one.
+    /// Memory allocated by the layout is reused.
+    /// </summary>
+    /// <param name="font">The font to use to shape the text.</param>
+    /// <param name="text">The UTF-8 encoded text to shape.</param>
+    /// <param name="maxWidth">(optional) The width to wrap the text at. Default: 0 (no word wrap).</param>
+    void set( const Font& font, std::string_view text, float maxWidth = 0.0f );
+
+    /// <summary>
+    /// Change the text of the layout, keeping the current font and wrap width.
+    /// </summary>
+    /// <param name="text">The UTF-8 encoded text to shape.</param>
+    void setText( std::string_view text );
+
+    /// <summary>
+    /// Get the font that was used to shape the text.
+    /// </summary>
+    /// <returns>The font, or `nullptr` if the layout is empty.</returns>
+    const Font* getFont() const noexcept
+    {
+        return font;
+    }
+
+    /// <summary>
+    /// Get the text of the layout.
+    /// </summary>
+    /// <returns>The UTF-8 encoded text.</returns>
+    std::string_view getText() const noexcept
+    {
+        return text;
+    }
+
+    /// <summary>
+    /// Get the glyphs of the layout.
+    /// If any of the glyphs were evicted from the glyph atlas, the text is shaped again.
+    /// </summary>
+    /// <returns>The glyphs in the order they appear in the text.</returns>
+    std::span<const Glyph> getGlyphs() const;
+
+    /// <summary>
+    /// Get the bounding rectangle of all the glyphs in the layout (relative to the origin of the text).
+    /// </summary>
+    /// <returns>The bounds of the layout.</returns>
+    const Math::RectI& getBounds() const noexcept
+    {
+        return bounds;
+    }
+
+    /// <summary>
+    /// Check if the layout contains any glyphs.
+    /// </summary>
+    /// <returns>`true` if the layout does not have any glyphs.</returns>
+    bool empty() const noexcept
+    {
+        return glyphs.empty();
+    }
+
+private:
+    // Shape the text.
+    void update() const;
+
+    const Font* font     = nullptr;
+    float       maxWidth = 0.0f;
+    std::string text;
+
+    // The shaped glyphs are updated when glyphs are evicted from the glyph atlas.
+    mutable std::vector<Glyph> glyphs;
+    mutable Math::RectI        bounds;
+};
+}  // namespace Graphics
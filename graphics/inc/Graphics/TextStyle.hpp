@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Color.hpp"
+
+#include <glm/vec2.hpp>
+
+namespace Graphics
+{
+/// <summary>
+/// Options for drawing text.
+/// Scale and outline are only supported by signed-distance-field fonts (see FontMode::SDF).
+/// </summary>
+struct TextStyle
+{
+    /// <summary>
+    /// The color of the text.
+    /// </summary>
+    Color color { Color::White };
+
+    /// <summary>
+    /// The size to draw the text relative to the size of the font.
+    /// </summary>
+    float scale = 1.0f;
+
+    /// <summary>
+    /// The width of the outline (in pixels). Set to 0 to disable the outline.
+    /// </summary>
+    float outlineWidth = 0.0f;
+
+    /// <summary>
+    /// The color of the outline.
+    /// </summary>
+    Color outlineColor { Color::Black };
+
+    /// <summary>
+    /// The offset of the drop shadow (in pixels).
+    /// </summary>
+    glm::vec2 shadowOffset { 2.0f, 2.0f };
+
+    /// <summary>
+    /// The color of the drop shadow. The shadow is only drawn if the alpha of the shadow color is not 0.
+    /// </summary>
+    Color shadowColor { 0, 0, 0, 0 };
+
+    /// <summary>
+    /// Blurs the edge of the drop shadow (in pixels).
+    /// </summary>
+    float shadowSoftness = 1.0f;
+};
+}  // namespace Graphics
@@ -0,0 +1,109 @@
+#include <Graphics/AssetPack.hpp>
+#include <Graphics/Image.hpp>
+#include <Graphics/MappedFile.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+using namespace Graphics;
+
+uint64_t AssetPack::hashPath( const std::filesystem::path& path )
+{
+    return AssetId { path }.getValue();
+}
+
+AssetPack::AssetPack( const std::filesystem::path& packFile )
+{
+    // The pack is mapped copy-on-write: pages are shared with the file until they are written to, so images that alias
+    // the mapping can still be drawn to.
+    auto map = std::make_shared<MappedFile>( packFile, MappedFile::Access::CopyOnWrite );
+    if ( !*map )
+    {
+        std::cerr << "ERROR: Could not open asset pack: " << packFile.string() << std::endl;
+        return;
+    }
+
+    const size_t size = map->size();
+    Header       header;
+    if ( size < sizeof( Header ) )
+    {
+        std::cerr << "ERROR: Invalid asset pack: " << packFile.string() << std::endl;
+        return;
+    }
+
+    std::memcpy( &header, map->data(), sizeof( Header ) );
+
+    if ( header.magic != Magic || header.version != Version )
+    {
+        std::cerr << "ERROR: Invalid asset pack (or unsupported version): " << packFile.string() << std::endl;
+        return;
+    }
+
+    const uint64_t indexSize = static_cast<uint64_t>( header.numEntries ) * sizeof( Entry );
+    if ( header.indexOffset % alignof( Entry ) != 0 || header.indexOffset > size || indexSize > size - header.indexOffset || header.stringsOffset > size || header.stringsSize > size - header.stringsOffset )
+    {
+        std::cerr << "ERROR: Corrupt asset pack index: " << packFile.string() << std::endl;
+        return;
+    }
+
+    const std::span<const Entry> index { reinterpret_cast<const Entry*>( map->data() + header.indexOffset ), header.numEntries };
+
+    // Validate the entries once, so lookups don't have to.
+    for ( const Entry& entry: index )
+    {
+        const bool valid = entry.compression == AssetCompression::None && entry.size == entry.rawSize &&
+                           entry.offset % DataAlignment == 0 && entry.offset <= size && entry.size <= size - entry.offset &&
+                           static_cast<uint64_t>( entry.pathOffset ) + entry.pathLength <= header.stringsSize &&
+                           ( entry.type != AssetType::Image || entry.size == static_cast<uint64_t>( entry.width ) * entry.height * sizeof( Color ) ) &&
+                           ( entry.type != AssetType::SpriteSheet || entry.size == sizeof( SpriteSheetInfo ) );
+
+        if ( !valid )
+        {
+            std::cerr << "ERROR: Corrupt asset pack entry: " << packFile.string() << std::endl;
+            return;
+        }
+    }
+
+    mapping = std::move( map );
+    entries = index;
+    strings = { reinterpret_cast<const char*>( mapping->data() + header.stringsOffset ), header.stringsSize };
+}
+
+const AssetPack::Entry* AssetPack::find( uint64_t id, AssetType type ) const noexcept
+{
+    const auto iter = std::ranges::lower_bound( entries, std::pair { id, type }, {}, []( const Entry& e ) { return std::pair { e.id, e.type }; } );
+
+    if ( iter == entries.end() || iter->id != id || iter->type != type )
+        return nullptr;
+
+    return &*iter;
+}
+
+std::span<const std::byte> AssetPack::getData( const Entry& entry ) const noexcept
+{
+    return { mapping->data() + entry.offset, entry.size };
+}
+
+std::string_view AssetPack::getPath( const Entry& entry ) const noexcept
+{
+    return strings.substr( entry.pathOffset, entry.pathLength );
+}
+
+std::shared_ptr<Image> AssetPack::loadImage( const Entry& entry ) const
+{
+    assert( entry.type == AssetType::Image );
+
+    // The pixels are stored pre-swizzled and 64-byte aligned, so the image can use the mapped memory directly.
+    auto* pixels = reinterpret_cast<Color*>( mapping->data() + entry.offset );
+
+    return std::make_shared<Image>( pixels, entry.width, entry.height, mapping );
+}
+
+const AssetPack::SpriteSheetInfo& AssetPack::getSpriteSheetInfo( const Entry& entry ) const noexcept
+{
+    assert( entry.type == AssetType::SpriteSheet );
+
+    return *reinterpret_cast<const SpriteSheetInfo*>( mapping->data() + entry.offset );
+}
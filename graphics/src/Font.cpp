@@ -1,185 +1,628 @@
-
-#include <Graphics/File.hpp>
-#include <Graphics/Font.hpp>
-#include <Graphics/Image.hpp>
-
-#include <stb_easy_font.h>
-
-#include <codecvt>
-#include <iostream>
-#include <vector>
-
-namespace fs = std::filesystem;
-using namespace Graphics;
-
-const Font Font::Default {};
-
-// Convert wchar_t string to char string.
-static std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> stringConverter;
-
-struct FontVertex
-{
-    float   x, y, z;
-    uint8_t color[4];
-};
-
-Font::Font( float size )
-: size { size }
-{}
-
-Font::Font( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars )
-: size { size }
-, firstChar { firstChar }
-, numChars { numChars }
-{
-    if ( fs::exists( fontFile ) && fs::is_regular_file( fontFile ) )
-    {
-        bakedChar = std::make_unique<stbtt_bakedchar[]>( numChars );
-        fontData  = File::readFile<unsigned char>( fontFile, std::ios::binary );
-
-        stbtt_InitFont( &fontInfo, fontData.data(), 0 );
-        // int x0, y0, x1, y1;
-        // stbtt_GetFontBoundingBox( &fontInfo, &x0, &y0, &x1, &y1 );
-        // float scale = stbtt_ScaleForPixelHeight( &fontInfo, size );
-
-        // I'm not sure how to calculate the exact size of the pixel buffer needed for the font.
-        // This pixel width is very liberal, but better safe than sorry.
-        const int pw         = static_cast<int>( std::ceil( static_cast<float>( numChars ) * size ) );
-        const int ph         = static_cast<int>( std::ceil( 2.0f * size ) );
-        auto      fontBitmap = std::make_unique<unsigned char[]>( static_cast<size_t>( pw ) * ph );
-
-        int numRows = stbtt_BakeFontBitmap( fontData.data(), 0, size, fontBitmap.get(), pw, ph,
-                                            static_cast<int>( firstChar ), static_cast<int>( numChars ), bakedChar.get() );
-
-        // Copy the alpha values of the font bitmap to the font image.
-        fontImage = std::make_unique<Image>( pw, ph );
-        Color* c  = fontImage->data();
-        for ( int y = 0; y < ph; ++y )
-        {
-            for ( int x = 0; x < pw; ++x )
-            {
-                size_t        i = static_cast<size_t>( y ) * pw + x;
-                unsigned char a = fontBitmap[i];
-
-                c[i] = Color { 255, 255, 255, a };
-            }
-        }
-
-        // Uncomment the next lines to save the font image to disk.
-        // This is mostly used for testing the font baking.
-        // auto fontTga = std::format( "{}/{}_{}.tga", fontFile.parent_path().string(), fontFile.stem().string(), size );
-        // fontImage->save( fontTga );
-    }
-    else
-    {
-        std::cerr << "Error reading file: " << fontFile << std::endl;
-    }
-}
-
-glm::vec2 Font::getSize( std::string_view text ) const noexcept
-{
-    float width  = 0.0f;
-    float height = 0.0f;
-
-    if ( fontImage && bakedChar )
-    {
-        // TODO: There must be a better way of computing the size of the text using font metrics.
-        // But using GetBakedQuad seems like the most obvious (but not optimal) approach.
-        Math::AABB  aabb;
-        const char* t    = text.data();
-        float       xPos = 0.0f;
-        float       yPos = 0.0f;
-        while ( *t )
-        {
-            if ( *t >= firstChar && *t < ( firstChar + numChars ) )
-            {
-                stbtt_aligned_quad q;
-                stbtt_GetBakedQuad( bakedChar.get(), static_cast<int>( fontImage->getWidth() ), static_cast<int>( fontImage->getHeight() ), *t - firstChar, &xPos, &yPos, &q, 1 );
-                aabb.expand( Math::AABB::fromMinMax( { q.x0, q.y0, 0 }, { q.x1, q.y1, 0 } ) );
-            }
-            else if ( *t == '\n' )
-            {
-                xPos = 0.0f;
-                yPos += size;
-            }
-
-            ++t;
-        }
-        width  = aabb.width();
-        height = aabb.height();
-    }
-    else
-    {
-        width  = static_cast<float>( stb_easy_font_width( text.data() ) ) * size;
-        height = static_cast<float>( stb_easy_font_height( text.data() ) ) * size;
-    }
-
-    return { width, height };
-}
-
-void Font::drawText( Image& image, std::string_view text, int x, int y, const Color& color ) const
-{
-    // Convert to wide character strings.
-    std::wstring wText = stringConverter.from_bytes( text.data() );
-    drawText( image, wText, x, y, color );
-}
-
-void Font::drawText( Image& image, std::wstring_view text, int x, int y, const Color& color ) const
-{
-    if ( fontImage && bakedChar )
-    {
-        const wchar_t* t    = text.data();
-        auto           xPos = static_cast<float>( x );
-        auto           yPos = static_cast<float>( y );
-        while ( *t )
-        {
-            if ( *t >= firstChar && *t < ( firstChar + numChars ) )
-            {
-                stbtt_aligned_quad q;
-                stbtt_GetBakedQuad( bakedChar.get(), static_cast<int>( fontImage->getWidth() ), static_cast<int>( fontImage->getHeight() ), static_cast<int>( *t - firstChar ), &xPos, &yPos, &q, 1 );
-
-                Vertex v0 { { q.x0, q.y0 }, { q.s0, q.t0 }, color };
-                Vertex v1 { { q.x1, q.y0 }, { q.s1, q.t0 }, color };
-                Vertex v2 { { q.x1, q.y1 }, { q.s1, q.t1 }, color };
-                Vertex v3 { { q.x0, q.y1 }, { q.s0, q.t1 }, color };
-
-                image.drawQuad( v0, v1, v2, v3, *fontImage, AddressMode::Clamp, BlendMode::AlphaBlend );
-                // image.drawQuad( { q.x0, q.y0 }, { q.x1, q.y0 }, { q.x1, q.y1 }, { q.x0, q.y1 }, Color::Red, {}, FillMode::WireFrame ); // For debugging glyph quads.
-            }
-            else if ( *t == '\n' )
-            {
-                xPos = static_cast<float>( x );
-                yPos += size;
-            }
-
-            ++t;
-        }
-    }
-    else
-    {
-        // Basic fonts only support ASCII characters. Try to convert the text to ASCII...
-        std::string strText = stringConverter.to_bytes( text.data() );
-
-        std::vector<FontVertex> vertexBuffer( text.length() * 40 );
-
-        const int numQuads = stb_easy_font_print( 0, 0, strText.data(), nullptr, vertexBuffer.data(), static_cast<int>( vertexBuffer.size() * sizeof( FontVertex ) ) );
-
-        // Scale the quads.
-        for ( auto& v: vertexBuffer )
-        {
-            v.x = v.x * size + static_cast<float>( x );
-            v.y = v.y * size + static_cast<float>( y );
-            v.z = v.z * size;
-        }
-
-        for ( int i = 0; i < numQuads; ++i )
-        {
-            const FontVertex& v0 = vertexBuffer[i * 4 + 0];
-            const FontVertex& v1 = vertexBuffer[i * 4 + 1];
-            const FontVertex& v2 = vertexBuffer[i * 4 + 2];
-            const FontVertex& v3 = vertexBuffer[i * 4 + 3];
-
-            image.drawQuad( { v0.x, v0.y }, { v1.x, v1.y }, { v2.x, v2.y }, { v3.x, v3.y }, color, {}, FillMode::Solid );
-        }
-    }
-}
+
+#include <Graphics/File.hpp>
+#include <Graphics/Font.hpp>
+#include <Graphics/GlyphAtlas.hpp>
+
+#include <stb_easy_font.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace Graphics;
+
+const Font Font::Default {};
+
+struct FontVertex
+{
+    float   x, y, z;
+    uint8_t color[4];
+};
+
+namespace
+{
+// Decodes the code points of a UTF-8 string.
+// Invalid or truncated sequences are decoded as the replacement character (U+FFFD).
+struct Utf8Decoder
+{
+    std::string_view text;
+    size_t           i = 0;
+
+    bool next( char32_t& cp ) noexcept
+    {
+        if ( i >= text.size() )
+            return false;
+
+        const auto c = static_cast<unsigned char>( text[i++] );
+
+        int len;
+        if ( c < 0x80 )
+        {
+            cp = c;
+            return true;
+        }
+        else if ( ( c & 0xE0 ) == 0xC0 )
+        {
+            cp  = c & 0x1F;
+            len = 1;
+        }
+        else if ( ( c & 0xF0 ) == 0xE0 )
+        {
+            cp  = c & 0x0F;
+            len = 2;
+        }
+        else if ( ( c & 0xF8 ) == 0xF0 )
+        {
+            cp  = c & 0x07;
+            len = 3;
+        }
+        else
+        {
+            cp = 0xFFFD;
+            return true;
+        }
+
+        for ( ; len > 0; --len )
+        {
+            if ( i >= text.size() || ( static_cast<unsigned char>( text[i] ) & 0xC0 ) != 0x80 )
+            {
+                cp = 0xFFFD;
+                return true;
+            }
+            cp = ( cp << 6 ) | ( static_cast<unsigned char>( text[i++] ) & 0x3F );
+        }
+
+        return true;
+    }
+};
+
+// Decodes the code points of a wide string (UTF-16 on Windows, UTF-32 elsewhere).
+struct WideDecoder
+{
+    std::wstring_view text;
+    size_t            i = 0;
+
+    bool next( char32_t& cp ) noexcept
+    {
+        if ( i >= text.size() )
+            return false;
+
+        cp = static_cast<char32_t>( text[i++] );
+
+        if constexpr ( sizeof( wchar_t ) == 2 )
+        {
+            if ( cp >= 0xD800 && cp < 0xDC00 )
+            {
+                if ( i < text.size() && text[i] >= 0xDC00 && text[i] < 0xE000 )
+                    cp = 0x10000 + ( ( cp - 0xD800 ) << 10 ) + ( static_cast<char32_t>( text[i++] ) - 0xDC00 );
+                else
+                    cp = 0xFFFD;
+            }
+        }
+
+        return true;
+    }
+};
+
+// Get a unique ID for a font.
+uint32_t nextFontId() noexcept
+{
+    static std::atomic<uint32_t> nextId { 1u };
+    return nextId++;
+}
+
+// FNV-1a hash of a string.
+uint64_t hashString( std::string_view text ) noexcept
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for ( const char c: text )
+    {
+        hash ^= static_cast<unsigned char>( c );
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+// A recently measured string.
+struct MeasureEntry
+{
+    uint32_t  fontId   = 0u;
+    uint64_t  hash     = 0u;
+    size_t    length   = 0u;
+    float     maxWidth = 0.0f;
+    glm::vec2 size { 0.0f };
+};
+
+// Small direct-mapped cache of measured strings (of all fonts).
+// Each thread has its own cache, so fonts (like Font::Default) can be measured from any thread.
+thread_local std::array<MeasureEntry, 64> t_MeasureCache {};
+}  // namespace
+
+Font::Font( float size )
+: size { size }
+, id { nextFontId() }
+{
+    loadDefaultGlyphs();
+}
+
+Font::Font( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars, FontMode mode, bool prewarm )
+: size { size }
+, mode { mode }
+, lineHeight { size }
+, id { nextFontId() }
+, firstChar { firstChar }
+{
+    if ( fs::exists( fontFile ) && fs::is_regular_file( fontFile ) )
+    {
+        auto file = std::make_shared<const MappedFile>( File::map( fontFile ) );
+        fontData    = { reinterpret_cast<const unsigned char*>( file->data() ), file->size() };
+        fontStorage = std::move( file );
+
+        if ( !loadFontData( numChars, prewarm ) )
+            std::cerr << "Error reading font: " << fontFile << std::endl;
+    }
+    else
+    {
+        std::cerr << "Error reading file: " << fontFile << std::endl;
+    }
+
+    // Fall back to the default font.
+    if ( fontData.empty() )
+    {
+        this->mode = FontMode::Bitmap;
+        loadDefaultGlyphs( prewarm );
+    }
+}
+
+Font::Font( std::span<const std::byte> data, float size, uint32_t firstChar, uint32_t numChars, FontMode mode, bool prewarm )
+: size { size }
+, mode { mode }
+, lineHeight { size }
+, id { nextFontId() }
+, firstChar { firstChar }
+{
+    auto copy   = std::make_shared<const std::vector<std::byte>>( data.begin(), data.end() );
+    fontData    = { reinterpret_cast<const unsigned char*>( copy->data() ), copy->size() };
+    fontStorage = std::move( copy );
+
+    if ( !loadFontData( numChars, prewarm ) )
+        std::cerr << "Error reading font data." << std::endl;
+
+    // Fall back to the default font.
+    if ( fontData.empty() )
+    {
+        this->mode = FontMode::Bitmap;
+        loadDefaultGlyphs( prewarm );
+    }
+}
+
+Font::Font( std::span<const std::byte> data, std::shared_ptr<const void> storage, float size, uint32_t firstChar, uint32_t numChars, FontMode mode, bool prewarm )
+: size { size }
+, mode { mode }
+, lineHeight { size }
+, id { nextFontId() }
+, firstChar { firstChar }
+, fontStorage { std::move( storage ) }
+{
+    fontData = { reinterpret_cast<const unsigned char*>( data.data() ), data.size() };
+
+    if ( !loadFontData( numChars, prewarm ) )
+        std::cerr << "Error reading font data." << std::endl;
+
+    // Fall back to the default font.
+    if ( fontData.empty() )
+    {
+        this->mode = FontMode::Bitmap;
+        loadDefaultGlyphs( prewarm );
+    }
+}
+
+bool Font::loadFontData( uint32_t numChars, bool prewarm )
+{
+    if ( fontData.empty() || !stbtt_InitFont( &fontInfo, fontData.data(), 0 ) )
+    {
+        fontData = {};
+        fontStorage.reset();
+        return false;
+    }
+
+    scale = stbtt_ScaleForPixelHeight( &fontInfo, size );
+
+    loadMetrics( numChars );
+
+    // Rasterize the most common glyphs up front. Other glyphs are rasterized when they are used.
+    if ( prewarm )
+    {
+        GlyphAtlas& atlas = GlyphAtlas::getShared();
+        atlas.beginBatch();
+        for ( uint32_t c = firstChar; c < firstChar + numChars; ++c )
+            getGlyph( atlas, c );
+    }
+
+    return true;
+}
+
+void Font::loadDefaultGlyphs( bool prewarm )
+{
+    // stb_easy_font covers the printable ASCII characters.
+    lineHeight = 12.0f * size;
+    firstChar  = 32;
+    metrics.resize( 95 );
+    for ( uint32_t i = 0; i < 95; ++i )
+        metrics[i] = { static_cast<float>( stb_easy_font_charinfo[i].advance & 15 ) * size, 0 };
+
+    if ( !prewarm )
+        return;
+
+    // Rasterize all of the glyphs up front.
+    GlyphAtlas& atlas = GlyphAtlas::getShared();
+    atlas.beginBatch();
+    for ( char32_t c = 32; c < 127; ++c )
+        getGlyph( atlas, c );
+}
+
+void Font::loadMetrics( uint32_t numChars )
+{
+    metrics.resize( numChars );
+    for ( uint32_t i = 0; i < numChars; ++i )
+    {
+        const int glyphIndex = stbtt_FindGlyphIndex( &fontInfo, static_cast<int>( firstChar + i ) );
+
+        int advance, leftSideBearing;
+        stbtt_GetGlyphHMetrics( &fontInfo, glyphIndex, &advance, &leftSideBearing );
+
+        metrics[i] = { static_cast<float>( advance ) * scale, glyphIndex };
+    }
+
+    // Kerning pairs are stored using the index of the characters in the preloaded range.
+    if ( const int tableLength = stbtt_GetKerningTableLength( &fontInfo ); tableLength > 0 )
+    {
+        // The font has a 'kern' table.
+        std::vector<stbtt_kerningentry> table( tableLength );
+        stbtt_GetKerningTable( &fontInfo, table.data(), tableLength );
+
+        std::unordered_map<int, uint32_t> glyphToChar;
+        for ( uint32_t i = 0; i < numChars; ++i )
+        {
+            if ( metrics[i].glyphIndex != 0 )
+                glyphToChar.emplace( metrics[i].glyphIndex, i );
+        }
+
+        for ( const auto& entry: table )
+        {
+            const auto first  = glyphToChar.find( entry.glyph1 );
+            const auto second = glyphToChar.find( entry.glyph2 );
+            if ( first != glyphToChar.end() && second != glyphToChar.end() && entry.advance != 0 )
+                kerning.push_back( { first->second << 16 | second->second, static_cast<float>( entry.advance ) * scale } );
+        }
+    }
+    else if ( fontInfo.gpos )
+    {
+        // GPOS kerning can't be enumerated, so query the pairs of (at most) the first 128 characters.
+        const uint32_t count = std::min( numChars, 128u );
+        for ( uint32_t i = 0; i < count; ++i )
+        {
+            for ( uint32_t j = 0; j < count; ++j )
+            {
+                if ( const int advance = stbtt_GetGlyphKernAdvance( &fontInfo, metrics[i].glyphIndex, metrics[j].glyphIndex ) )
+                    kerning.push_back( { i << 16 | j, static_cast<float>( advance ) * scale } );
+            }
+        }
+    }
+
+    std::ranges::sort( kerning, {}, &KerningPair::key );
+}
+
+glm::vec2 Font::getSize( std::string_view text ) const noexcept
+{
+    return measure( text );
+}
+
+float Font::getAdvance( char32_t codepoint ) const noexcept
+{
+    if ( codepoint >= firstChar && codepoint - firstChar < metrics.size() )
+        return metrics[codepoint - firstChar].advance;
+
+    if ( fontData.empty() )
+        return metrics['?' - firstChar].advance;
+
+    int advance, leftSideBearing;
+    stbtt_GetCodepointHMetrics( &fontInfo, static_cast<int>( codepoint ), &advance, &leftSideBearing );
+
+    return static_cast<float>( advance ) * scale;
+}
+
+float Font::getKerning( char32_t first, char32_t second ) const noexcept
+{
+    if ( kerning.empty() )
+        return 0.0f;
+
+    const char32_t i = first - firstChar;
+    const char32_t j = second - firstChar;
+    if ( i >= metrics.size() || j >= metrics.size() )
+        return 0.0f;
+
+    const uint32_t key  = i << 16 | j;
+    const auto     iter = std::ranges::lower_bound( kerning, key, {}, &KerningPair::key );
+
+    return iter != kerning.end() && iter->key == key ? iter->advance : 0.0f;
+}
+
+glm::vec2 Font::measure( std::string_view text, float maxWidth ) const noexcept
+{
+    if ( text.empty() )
+        return { 0.0f, 0.0f };
+
+    const uint64_t hash  = hashString( text );
+    MeasureEntry&  entry = t_MeasureCache[( hash ^ id * 0x9E3779B97F4A7C15ull ) % t_MeasureCache.size()];
+    if ( entry.fontId == id && entry.hash == hash && entry.length == text.size() && entry.maxWidth == maxWidth )
+        return entry.size;
+
+    float    width     = 0.0f;
+    float    xPos      = 0.0f;
+    float    lineEnd   = 0.0f;  // The advance of the last visible character on the line.
+    float    wordX     = 0.0f;  // The pen position at the start of the current word.
+    float    wordStart = 0.0f;  // The end of the line before the current word.
+    int      lines     = 1;
+    char32_t prev      = 0;
+
+    Utf8Decoder decoder { text };
+    char32_t    cp;
+    while ( decoder.next( cp ) )
+    {
+        if ( cp == '\n' )
+        {
+            width = std::max( width, lineEnd );
+            xPos = lineEnd = wordX = wordStart = 0.0f;
+            prev                               = 0;
+            ++lines;
+            continue;
+        }
+
+        // Skip other control characters.
+        if ( cp < ' ' )
+            continue;
+
+        xPos += getKerning( prev, cp );
+        prev = cp;
+
+        const float advance = getAdvance( cp );
+
+        if ( cp == ' ' )
+        {
+            xPos += advance;
+            wordX     = xPos;
+            wordStart = lineEnd;
+            continue;
+        }
+
+        // Move the current word to the next line if it doesn't fit.
+        if ( maxWidth > 0.0f && wordX > 0.0f && xPos + advance > maxWidth )
+        {
+            width = std::max( width, wordStart );
+            xPos -= wordX;
+            wordX = 0.0f;
+            ++lines;
+        }
+
+        xPos += advance;
+        lineEnd = xPos;
+    }
+
+    width = std::max( width, lineEnd );
+
+    entry = { id, hash, text.size(), maxWidth, { width, static_cast<float>( lines ) * lineHeight } };
+
+    return entry.size;
+}
+
+uint32_t Font::getGlyph( GlyphAtlas& atlas, char32_t codepoint ) const
+{
+    const uint64_t key  = GlyphAtlas::makeKey( id, codepoint );
+    uint32_t       slot = atlas.find( key );
+
+    if ( slot == GlyphAtlas::InvalidSlot )
+    {
+        if ( fontData.empty() )
+        {
+            // Rasterize the quads that stb_easy_font generates for the character.
+            const char text[2] = { static_cast<char>( codepoint ), 0 };
+
+            FontVertex vertexBuffer[256];
+            const int  numQuads = stb_easy_font_print( 0, 0, text, nullptr, vertexBuffer, static_cast<int>( sizeof( vertexBuffer ) ) );
+
+            // Snap the quads to whole pixels (like drawing them as solid quads would).
+            Math::RectI quads[64];
+            int         left = std::numeric_limits<int>::max(), top = std::numeric_limits<int>::max();
+            int         right = std::numeric_limits<int>::min(), bottom = std::numeric_limits<int>::min();
+            for ( int i = 0; i < numQuads; ++i )
+            {
+                const FontVertex& v0 = vertexBuffer[i * 4 + 0];
+                const FontVertex& v2 = vertexBuffer[i * 4 + 2];
+
+                const int x0 = static_cast<int>( std::floor( v0.x * size + 0.5f ) );
+                const int y0 = static_cast<int>( std::floor( v0.y * size + 0.5f ) );
+                const int x1 = std::max( static_cast<int>( std::floor( v2.x * size + 0.5f ) ), x0 + 1 );
+                const int y1 = std::max( static_cast<int>( std::floor( v2.y * size + 0.5f ) ), y0 + 1 );
+
+                quads[i] = { x0, y0, x1 - x0, y1 - y0 };
+
+                left   = std::min( left, x0 );
+                top    = std::min( top, y0 );
+                right  = std::max( right, x1 );
+                bottom = std::max( bottom, y1 );
+            }
+
+            // Glyphs without pixels (like spaces) are not stored in the atlas.
+            if ( numQuads == 0 )
+                return GlyphAtlas::InvalidSlot;
+
+            slot = atlas.insert( key, right - left, bottom - top, { left, top } );
+            if ( slot != GlyphAtlas::InvalidSlot )
+            {
+                uint8_t* dst = atlas.data( slot );
+                for ( int i = 0; i < numQuads; ++i )
+                {
+                    const Math::RectI& q = quads[i];
+                    for ( int y = q.top; y < q.bottom(); ++y )
+                        std::memset( dst + static_cast<size_t>( y - top ) * atlas.getWidth() + ( q.left - left ), 255, q.width );
+                }
+            }
+        }
+        else if ( mode == FontMode::SDF )
+        {
+            int            w, h, xOff, yOff;
+            unsigned char* sdf = stbtt_GetCodepointSDF( &fontInfo, scale, static_cast<int>( codepoint ), SDFPadding, SDFOnEdgeValue, SDFPixelDistScale, &w, &h, &xOff, &yOff );
+
+            // Glyphs without an outline (like spaces) are not stored in the atlas.
+            if ( !sdf )
+                return GlyphAtlas::InvalidSlot;
+
+            slot = atlas.insert( key, w, h, { xOff, yOff } );
+            if ( slot != GlyphAtlas::InvalidSlot )
+            {
+                uint8_t* dst = atlas.data( slot );
+                for ( int y = 0; y < h; ++y )
+                    std::memcpy( dst + static_cast<size_t>( y ) * atlas.getWidth(), sdf + static_cast<size_t>( y ) * w, w );
+            }
+
+            stbtt_FreeSDF( sdf, nullptr );
+        }
+        else
+        {
+            int x0, y0, x1, y1;
+            stbtt_GetCodepointBitmapBox( &fontInfo, static_cast<int>( codepoint ), scale, scale, &x0, &y0, &x1, &y1 );
+
+            // Glyphs without pixels (like spaces) are not stored in the atlas.
+            if ( x1 <= x0 || y1 <= y0 )
+                return GlyphAtlas::InvalidSlot;
+
+            slot = atlas.insert( key, x1 - x0, y1 - y0, { x0, y0 } );
+            if ( slot != GlyphAtlas::InvalidSlot )
+                stbtt_MakeCodepointBitmap( &fontInfo, atlas.data( slot ), x1 - x0, y1 - y0, static_cast<int>( atlas.getWidth() ), scale, scale, static_cast<int>( codepoint ) );
+        }
+    }
+
+    return slot;
+}
+
+void Font::emitGlyph( GlyphAtlas& atlas, char32_t codepoint, float xPos, float yPos, std::vector<Glyph>& glyphs ) const
+{
+    // The default font only supports printable ASCII characters.
+    if ( fontData.empty() && codepoint >= 0x7F )
+        codepoint = '?';
+
+    const uint32_t slot = getGlyph( atlas, codepoint );
+    if ( slot == GlyphAtlas::InvalidSlot )
+        return;
+
+    // Snap the pen position to whole pixels so the glyph can be blitted without resampling.
+    const int x = static_cast<int>( std::floor( xPos + 0.5f ) );
+    const int y = static_cast<int>( std::floor( yPos + 0.5f ) );
+
+    const GlyphAtlas::Entry& entry = atlas.getEntry( slot );
+    const Math::RectI        dst { x + entry.offset.x, y + entry.offset.y, entry.rect.width, entry.rect.height };
+
+    glyphs.push_back( { dst, slot, entry.generation } );
+}
+
+template<typename Decoder>
+void Font::shape( Decoder&& decoder, float maxWidth, std::vector<Glyph>& glyphs, Math::RectI& bounds ) const
+{
+    GlyphAtlas& atlas = GlyphAtlas::getShared();
+    atlas.beginBatch();
+
+    const size_t first     = glyphs.size();
+    size_t       wordStart = first;  // The first glyph of the current word.
+    float        wordX     = 0.0f;   // The pen position at the start of the current word.
+    float        xPos      = 0.0f;
+    float        yPos      = 0.0f;
+    char32_t     prev      = 0;
+
+    char32_t cp;
+    while ( decoder.next( cp ) )
+    {
+        if ( cp == '\n' )
+        {
+            xPos = wordX = 0.0f;
+            yPos += lineHeight;
+            prev      = 0;
+            wordStart = glyphs.size();
+            continue;
+        }
+
+        // Skip other control characters.
+        if ( cp < ' ' )
+            continue;
+
+        xPos += getKerning( prev, cp );
+        prev = cp;
+
+        const float advance = getAdvance( cp );
+
+        if ( cp == ' ' )
+        {
+            xPos += advance;
+            wordX     = xPos;
+            wordStart = glyphs.size();
+            continue;
+        }
+
+        // Move the current word to the next line if it doesn't fit.
+        if ( maxWidth > 0.0f && wordX > 0.0f && xPos + advance > maxWidth )
+        {
+            const int dx = static_cast<int>( std::floor( wordX + 0.5f ) );
+            const int dy = static_cast<int>( std::floor( yPos + lineHeight + 0.5f ) ) - static_cast<int>( std::floor( yPos + 0.5f ) );
+            for ( size_t i = wordStart; i < glyphs.size(); ++i )
+            {
+                glyphs[i].dst.left -= dx;
+                glyphs[i].dst.top += dy;
+            }
+
+            xPos -= wordX;
+            yPos += lineHeight;
+            wordX = 0.0f;
+        }
+
+        emitGlyph( atlas, cp, xPos, yPos, glyphs );
+        xPos += advance;
+    }
+
+    // Compute the bounds of the glyphs.
+    bounds = {};
+    if ( glyphs.size() > first )
+    {
+        int left = std::numeric_limits<int>::max(), top = std::numeric_limits<int>::max();
+        int right = std::numeric_limits<int>::min(), bottom = std::numeric_limits<int>::min();
+        for ( size_t i = first; i < glyphs.size(); ++i )
+        {
+            const Math::RectI& dst = glyphs[i].dst;
+
+            left   = std::min( left, dst.left );
+            top    = std::min( top, dst.top );
+            right  = std::max( right, dst.right() );
+            bottom = std::max( bottom, dst.bottom() );
+        }
+
+        bounds = { left, top, right - left, bottom - top };
+    }
+}
+
+void Font::layout( std::string_view text, std::vector<Glyph>& glyphs, Math::RectI& bounds, float maxWidth ) const
+{
+    shape( Utf8Decoder { text }, maxWidth, glyphs, bounds );
+}
+
+void Font::layout( std::wstring_view text, std::vector<Glyph>& glyphs, Math::RectI& bounds, float maxWidth ) const
+{
+    shape( WideDecoder { text }, maxWidth, glyphs, bounds );
+}
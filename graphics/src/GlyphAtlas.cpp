@@ -0,0 +1,251 @@
+#include <Graphics/GlyphAtlas.hpp>
+#include <Graphics/TextLayout.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+using namespace Graphics;
+
+// Empty pixels between glyphs so filtered lookups don't bleed into neighboring glyphs.
+constexpr int Padding = 1;
+
+// The initial height of the atlas.
+constexpr uint32_t MinHeight = 64u;
+
+GlyphAtlas::GlyphAtlas( uint32_t width, size_t memoryBudget )
+: width { width }
+, maxHeight { static_cast<uint32_t>( std::max<size_t>( memoryBudget / width, 1u ) ) }
+{}
+
+GlyphAtlas& GlyphAtlas::getShared()
+{
+    static GlyphAtlas atlas;
+    return atlas;
+}
+
+uint32_t GlyphAtlas::find( uint64_t key ) noexcept
+{
+    const auto iter = lookup.find( key );
+    if ( iter == lookup.end() )
+        return InvalidSlot;
+
+    touch( iter->second );
+
+    return iter->second;
+}
+
+uint32_t GlyphAtlas::insert( uint64_t key, int w, int h, const glm::i32vec2& offset )
+{
+    assert( !lookup.contains( key ) );
+    assert( w > 0 && h > 0 );
+
+    Math::RectI rect;
+    int         shelfY = 0;
+
+    if ( !allocate( w, h, rect, shelfY ) )
+    {
+        // Evict the least-recently used glyphs (that are not used by the current batch) until the glyph fits.
+        std::vector<uint32_t> candidates;
+        for ( uint32_t i = 0; i < static_cast<uint32_t>( slots.size() ); ++i )
+        {
+            if ( slots[i].resident && slots[i].lastUsed < tick )
+                candidates.push_back( i );
+        }
+
+        std::ranges::sort( candidates, {}, [this]( uint32_t i ) { return slots[i].lastUsed; } );
+
+        bool allocated = false;
+        for ( uint32_t i: candidates )
+        {
+            evict( i );
+            if ( ( allocated = allocate( w, h, rect, shelfY ) ) )
+                break;
+        }
+
+        if ( !allocated )
+            return InvalidSlot;
+    }
+
+    uint32_t slot;
+    if ( !freeSlots.empty() )
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>( slots.size() );
+        slots.emplace_back();
+    }
+
+    Slot& s        = slots[slot];
+    s.entry.rect   = { rect.left, rect.top, w, h };
+    s.entry.offset = offset;
+    s.key          = key;
+    s.lastUsed     = tick;
+    s.shelfY       = shelfY;
+    s.resident     = true;
+
+    lookup.emplace( key, slot );
+
+    // Clear the glyph (and its padding) since the space may have been used by an evicted glyph.
+    for ( int y = rect.top; y < rect.bottom(); ++y )
+        std::memset( pixels.data() + static_cast<size_t>( y ) * width + rect.left, 0, rect.width );
+
+    return slot;
+}
+
+bool GlyphAtlas::isResident( std::span<const Glyph> glyphs ) const noexcept
+{
+    for ( const Glyph& glyph: glyphs )
+    {
+        if ( glyph.slot == InvalidSlot )
+            continue;
+
+        if ( glyph.slot >= slots.size() || slots[glyph.slot].entry.generation != glyph.generation )
+            return false;
+    }
+
+    return true;
+}
+
+void GlyphAtlas::clear() noexcept
+{
+    for ( auto& slot: slots )
+    {
+        if ( slot.resident )
+            ++slot.entry.generation;
+
+        slot.resident = false;
+    }
+
+    freeSlots.clear();
+    for ( uint32_t i = static_cast<uint32_t>( slots.size() ); i > 0; --i )
+        freeSlots.push_back( i - 1 );
+
+    lookup.clear();
+    shelves.clear();
+}
+
+bool GlyphAtlas::allocate( int w, int h, Math::RectI& rect, int& shelfY )
+{
+    const int pw = w + Padding;
+    const int ph = h + Padding;
+
+    if ( pw > static_cast<int>( width ) || ph > static_cast<int>( maxHeight ) )
+        return false;
+
+    // Find the shelf with the smallest height that fits the glyph.
+    // Shelves that are much taller than the glyph are skipped (unless they are empty) to avoid wasting space.
+    Shelf* best = nullptr;
+    Span*  span = nullptr;
+    for ( auto& shelf: shelves )
+    {
+        if ( shelf.height < ph || ( best && shelf.height >= best->height ) )
+            continue;
+
+        if ( shelf.used > 0 && shelf.height * 3 > ph * 4 + 6 )
+            continue;
+
+        const auto iter = std::ranges::find_if( shelf.free, [pw]( const Span& s ) { return s.width >= pw; } );
+        if ( iter != shelf.free.end() )
+        {
+            best = &shelf;
+            span = &*iter;
+        }
+    }
+
+    if ( best )
+    {
+        rect = { span->x, best->y, pw, ph };
+        span->x += pw;
+        span->width -= pw;
+        if ( span->width == 0 )
+            best->free.erase( best->free.begin() + ( span - best->free.data() ) );
+
+        ++best->used;
+        shelfY = best->y;
+
+        return true;
+    }
+
+    // Start a new shelf below the last shelf.
+    const int top = shelves.empty() ? 0 : shelves.back().y + shelves.back().height;
+    if ( top + ph > static_cast<int>( height ) )
+    {
+        if ( top + ph > static_cast<int>( maxHeight ) )
+            return false;
+
+        // Grow the atlas. Since the width (stride) of the atlas never changes, existing glyphs keep their position.
+        uint32_t newHeight = std::max( height, MinHeight );
+        while ( newHeight < static_cast<uint32_t>( top + ph ) )
+            newHeight *= 2u;
+
+        height = std::min( newHeight, maxHeight );
+        pixels.resize( static_cast<size_t>( width ) * height );
+    }
+
+    Shelf& shelf = shelves.emplace_back( top, ph );
+    shelf.used   = 1;
+    if ( pw < static_cast<int>( width ) )
+        shelf.free.push_back( { pw, static_cast<int>( width ) - pw } );
+
+    rect   = { 0, top, pw, ph };
+    shelfY = top;
+
+    return true;
+}
+
+void GlyphAtlas::evict( uint32_t slot )
+{
+    Slot& s = slots[slot];
+    assert( s.resident );
+
+    // Shelves are sorted by their y-coordinate.
+    auto shelf = std::ranges::lower_bound( shelves, s.shelfY, {}, &Shelf::y );
+    assert( shelf != shelves.end() && shelf->y == s.shelfY );
+
+    // Return the space to the shelf, merging it with adjacent free spans.
+    Span       freed { s.entry.rect.left, s.entry.rect.width + Padding };
+    auto&      free = shelf->free;
+    const auto next = std::ranges::lower_bound( free, freed.x, {}, &Span::x );
+    auto       iter = free.insert( next, freed );
+
+    if ( iter + 1 != free.end() && iter->x + iter->width == ( iter + 1 )->x )
+    {
+        iter->width += ( iter + 1 )->width;
+        free.erase( iter + 1 );
+    }
+    if ( iter != free.begin() && ( iter - 1 )->x + ( iter - 1 )->width == iter->x )
+    {
+        ( iter - 1 )->width += iter->width;
+        free.erase( iter );
+    }
+
+    if ( --shelf->used == 0 )
+    {
+        // Merge empty shelves so taller glyphs can reuse the space.
+        if ( shelf + 1 != shelves.end() && ( shelf + 1 )->used == 0 )
+        {
+            shelf->height += ( shelf + 1 )->height;
+            shelves.erase( shelf + 1 );
+        }
+        if ( shelf != shelves.begin() && ( shelf - 1 )->used == 0 )
+        {
+            ( shelf - 1 )->height += shelf->height;
+            shelf = shelves.erase( shelf ) - 1;
+        }
+
+        shelf->free.assign( 1, { 0, static_cast<int>( width ) } );
+
+        // The last shelf can be removed so a new shelf of any height can be started.
+        if ( shelf + 1 == shelves.end() )
+            shelves.pop_back();
+    }
+
+    lookup.erase( s.key );
+    ++s.entry.generation;
+    s.resident = false;
+    freeSlots.push_back( slot );
+}
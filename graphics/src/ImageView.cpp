@@ -0,0 +1,949 @@
+#include <Graphics/Font.hpp>
+#include <Graphics/GlyphAtlas.hpp>
+#include <Graphics/ImageView.hpp>
+#include <Graphics/Shaders.hpp>
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteSheet.hpp>
+#include <Graphics/TextLayout.hpp>
+#include <Graphics/Vertex.hpp>
+
+#include <Math/AABB.hpp>
+#include <Math/Math.hpp>
+
+#include <glm/gtx/matrix_query.hpp>
+#include <glm/mat2x2.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numbers>
+#include <optional>
+#include <vector>
+
+using namespace Graphics;
+using namespace Math;
+
+ImageView::ImageView( Color* data, uint32_t width, uint32_t height, uint32_t stride ) noexcept
+{
+    reset( data, width, height, stride );
+}
+
+void ImageView::reset( Color* data, uint32_t width, uint32_t height, uint32_t stride ) noexcept
+{
+    m_data   = data;
+    m_width  = width;
+    m_height = height;
+    m_stride = stride != 0u ? stride : width;
+
+    // An empty view gets an invalid AABB so that nothing intersects it.
+    if ( m_data && m_width > 0u && m_height > 0u )
+    {
+        m_AABB = {
+            { 0, 0, 0 },
+            { m_width - 1, m_height - 1, 0 }
+        };
+    }
+    else
+    {
+        m_AABB = {};
+    }
+}
+
+ImageView ImageView::getView( const Math::RectI& rect ) noexcept
+{
+    const int left   = std::max( rect.left, 0 );
+    const int top    = std::max( rect.top, 0 );
+    const int right  = std::min( rect.right(), static_cast<int>( m_width ) );
+    const int bottom = std::min( rect.bottom(), static_cast<int>( m_height ) );
+
+    if ( !m_data || right <= left || bottom <= top )
+        return {};
+
+    return { m_data + static_cast<size_t>( top ) * m_stride + left, static_cast<uint32_t>( right - left ), static_cast<uint32_t>( bottom - top ), m_stride };
+}
+
+void ImageView::clear( const Color& color ) noexcept
+{
+    // Fill the first row, then copy it to the remaining rows (the rows of a view may not be contiguous).
+    if ( !m_data )
+        return;
+
+    std::fill_n( m_data, m_width, color );
+
+    const Color* row = m_data;
+
+#pragma omp parallel for
+    for ( int y = 1; y < static_cast<int>( m_height ); ++y )
+        memcpy_s( m_data + static_cast<size_t>( y ) * m_stride, m_width * sizeof( Color ), row, m_width * sizeof( Color ) );
+}
+
+void ImageView::copy( const ImageView& srcImage, std::optional<Math::RectI> srcRect, std::optional<Math::RectI> dstRect, const BlendMode& blendMode )
+{
+    // If the source rectangle is not provided, use the entire source image.
+    AABB srcAABB = AABB::fromRect( srcRect ? *srcRect : srcImage.getRect() );
+    // If the destination rect is not provided, use the entire source image.
+    // I assume that the "expected behaviour" of this method is to copy the source image to the
+    // destination image (without scaling) even if that results in clipping of the source image.
+    AABB dstAABB = AABB::fromRect( dstRect ? *dstRect : srcImage.getRect() );
+
+    // If the source AABB doesn't intersect with the source image bounds.
+    // In other words, the source image rectangle doesn't cover any part of the source image.
+    if ( !srcImage.m_AABB.intersect( srcAABB ) )
+        return;
+
+    // Clamp the source AABB to the AABB of the source image (to prevent sampling outside of the source image bounds).
+    srcAABB.clamp( srcImage.m_AABB );
+
+    // Source width
+    const int sW = static_cast<int>( srcAABB.width() );
+    // Source height
+    const int sH = static_cast<int>( srcAABB.height() );
+
+    // If the destination AABB doesn't intersect with this image bounds...
+    // In other words, the destination bounds is completely offscreen.
+    if ( !m_AABB.intersect( dstAABB ) )
+        return;
+
+    // Destination width
+    const int dW = static_cast<int>( dstAABB.width() );
+    // Destination height
+    const int dH = static_cast<int>( dstAABB.height() );
+
+    // Clamp the dstAABB to the bounds of this image (to prevent writing outside of this image's bounds).
+    AABB dstImage = dstAABB.clamped( m_AABB );
+
+    // Clamped image width.
+    const int iW = static_cast<int>( dstImage.width() );
+    // Clamped image height.
+    const int iH = static_cast<int>( dstImage.height() );
+    // Clamped image area
+    const int iA = iW * iH;
+
+    // Pointer to source image data.
+    const Color* src = srcImage.data();
+    // Pointer to destination image data.
+    Color* dst = data();
+
+#pragma omp parallel for firstprivate( srcAABB, dstAABB, dstImage, sW, sH, dW, dH, iW, iH )
+    for ( int i = 0; i < iA; ++i )
+    {
+        const int x  = i % iW;
+        const int y  = i / iW;
+        const int dx = x + static_cast<int>( dstImage.min.x );
+        const int dy = y + static_cast<int>( dstImage.min.y );
+        const int sx = ( x * sW / dW ) + static_cast<int>( srcAABB.min.x );
+        const int sy = ( y * sH / dH ) + static_cast<int>( srcAABB.min.y );
+
+        const Color sC = src[sy * srcImage.m_stride + sx];
+        const Color dC = dst[dy * m_stride + dx];
+
+        dst[dy * m_stride + dx] = blendMode.Blend( sC, dC );
+    }
+}
+
+void ImageView::copy( const ImageView& srcImage, int x, int y )
+{
+    // Source image coords.
+    const int sX = x < 0 ? -x : 0;
+    const int sY = y < 0 ? -y : 0;
+    const int sW = static_cast<int>( srcImage.getWidth() ) - sX;
+    const int sH = static_cast<int>( srcImage.getHeight() ) - sY;
+
+    // Check if source image is offscreen.
+    if ( sW <= 0 || sH <= 0 )
+        return;
+
+    // Destination coords.
+    const int dX = x < 0 ? 0 : x;
+    const int dY = y < 0 ? 0 : y;
+    const int dW = static_cast<int>( m_width ) - dX;
+    const int dH = static_cast<int>( m_height ) - dY;
+
+    // Check if the destination range is offscreen.
+    if ( dW <= 0 || dH <= 0 )
+        return;
+
+    // The destination copy region is the minimum of the source
+    // and destination dimensions.
+    const int w = std::min( sW, dW );
+    const int h = std::min( sH, dH );
+
+    const uint32_t srcStride = srcImage.getStride();
+    const Color*   src       = srcImage.data();
+    Color*         dst      = data();
+
+#pragma omp parallel for firstprivate( w, h, sX, sY, dX, dY )
+    for ( int i = 0; i < h; ++i )
+        memcpy_s( dst + ( i + dY ) * m_stride + dX, w * sizeof( Color ), src + ( i + sY ) * srcStride + sX, w * sizeof( Color ) );
+}
+
+// Source: https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+void ImageView::drawLine( int x0, int y0, int x1, int y1, const Color& color, const BlendMode& blendMode ) noexcept
+{
+    // Shrink the image AABB by 1 pixel to prevent drawing the line outside of the image bounds.
+    if ( !m_AABB.clip( x0, y0, x1, y1 ) )
+        return;
+
+    const int dx = std::abs( x1 - x0 );
+    const int dy = -std::abs( y1 - y0 );
+    const int sx = x0 < x1 ? 1 : -1;
+    const int sy = y0 < y1 ? 1 : -1;
+
+    int err = dx + dy;
+
+    while ( true )
+    {
+        plot<false>( x0, y0, color, blendMode );
+        const int e2 = err * 2;
+
+        if ( e2 >= dy )
+        {
+            if ( x0 == x1 )
+                break;
+
+            err += dy;
+            x0 += sx;
+        }
+        if ( e2 <= dx )
+        {
+            if ( y0 == y1 )
+                break;
+
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void ImageView::drawTriangle( const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+{
+    // Create an AABB for the triangle.
+    AABB aabb = AABB::fromTriangle( { p0, 0 }, { p1, 0 }, { p2, 0 } );
+
+    // Check if the triangle is on screen.
+    if ( !m_AABB.intersect( aabb ) )
+        return;
+
+    switch ( fillMode )
+    {
+    case FillMode::WireFrame:
+    {
+        drawLine( p0, p1, color, blendMode );
+        drawLine( p1, p2, color, blendMode );
+        drawLine( p2, p0, color, blendMode );
+    }
+    break;
+    case FillMode::Solid:
+    {
+        // Clamp the triangle AABB to the screen bounds.
+        aabb.clamp( m_AABB );
+
+#pragma omp parallel for schedule( dynamic ) firstprivate( aabb )
+        for ( int y = static_cast<int>( aabb.min.y ); y <= static_cast<int>( aabb.max.y ); ++y )
+        {
+            for ( int x = static_cast<int>( aabb.min.x ); x <= static_cast<int>( aabb.max.x ); ++x )
+            {
+                if ( pointInsideTriangle( { x, y }, p0, p1, p2 ) )
+                    plot<false>( x, y, color, blendMode );
+            }
+        }
+    }
+    break;
+    }
+}
+
+void ImageView::drawQuad( const glm::vec2& p0, const glm::vec2& p1, const glm::vec2& p2, const glm::vec2& p3, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+{
+    AABB aabb = AABB::fromQuad( { p0, 0 }, { p1, 0 }, { p2, 0 }, { p3, 0 } );
+
+    // Check if the triangle is on screen.
+    if ( !m_AABB.intersect( aabb ) )
+        return;
+
+    switch ( fillMode )
+    {
+    case FillMode::WireFrame:
+    {
+        drawLine( p0, p1, color, blendMode );
+        drawLine( p1, p2, color, blendMode );
+        drawLine( p2, p3, color, blendMode );
+        drawLine( p3, p0, color, blendMode );
+    }
+    break;
+    case FillMode::Solid:
+    {
+        glm::vec2 verts[] = {
+            p0, p1, p2, p3
+        };
+
+        // Index buffer for the two triangles of the quad.
+        const uint32_t indicies[] = {
+            0, 1, 3,
+            1, 2, 3
+        };
+
+        // Clamp to the size of the screen.
+        aabb.clamp( m_AABB );
+
+#pragma omp parallel for schedule( dynamic ) firstprivate( aabb, indicies, verts )
+        for ( int y = static_cast<int>( aabb.min.y ); y <= static_cast<int>( aabb.max.y ); ++y )
+        {
+            for ( int x = static_cast<int>( aabb.min.x ); x <= static_cast<int>( aabb.max.x ); ++x )
+            {
+                for ( uint32_t i = 0; i < std::size( indicies ); i += 3 )
+                {
+                    const uint32_t i0 = indicies[i + 0];
+                    const uint32_t i1 = indicies[i + 1];
+                    const uint32_t i2 = indicies[i + 2];
+
+                    glm::vec3 bc = barycentric( verts[i0], verts[i1], verts[i2], { x, y } );
+                    if ( barycentricInside( bc ) )
+                    {
+                        plot<false>( static_cast<uint32_t>( x ), static_cast<uint32_t>( y ), color, blendMode );
+                    }
+                }
+            }
+        }
+    }
+    break;
+    }
+}
+
+void ImageView::drawQuad( const Vertex& v0, const Vertex& v1, const Vertex& v2, const Vertex& v3, const ImageView& image, AddressMode addressMode, const BlendMode& blendMode )
+{
+    drawQuad( v0, v1, v2, v3, TextureShader { image, addressMode, blendMode } );
+}
+
+void ImageView::drawAABB( AABB aabb, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+{
+    if ( !m_AABB.intersect( aabb ) )
+        return;
+
+    switch ( fillMode )
+    {
+    case FillMode::WireFrame:
+    {
+        const glm::ivec2 min     = aabb.min;
+        const glm::ivec2 max     = aabb.max;
+        const glm::ivec2 verts[] = { { min.x, min.y }, { max.x, min.y }, { max.x, max.y }, { min.x, max.y } };
+
+        for ( int i = 0; i < 4; ++i )
+        {
+            drawLine( verts[i], verts[( i + 1 ) % 4], color, blendMode );
+        }
+    }
+    break;
+    case FillMode::Solid:
+    {
+        // Clamp to screen bounds.
+        aabb.clamp( m_AABB );
+
+#pragma omp parallel for schedule( dynamic ) firstprivate( aabb )
+        for ( int y = static_cast<int>( aabb.min.y ); y <= static_cast<int>( aabb.max.y ); ++y )
+        {
+            for ( int x = static_cast<int>( aabb.min.x ); x <= static_cast<int>( aabb.max.x ); ++x )
+            {
+                plot<false>( x, y, color, blendMode );
+            }
+        }
+    }
+    break;
+    }
+}
+
+void ImageView::drawCircle( const Math::Circle& c, const Color& color, const BlendMode& blendMode, FillMode fillMode ) noexcept
+{
+    if ( !m_AABB.intersect( c ) )
+        return;
+
+    for ( int i = 0; i < 64; ++i )
+    {
+        const float a1 = static_cast<float>( i ) * std::numbers::pi_v<float> / 32.0f;
+        const float a2 = static_cast<float>( i + 1 ) * std::numbers::pi_v<float> / 32.0f;
+
+        const glm::vec2 p0 { c.center.x + std::cos( a1 ) * c.radius, c.center.y + std::sin( a1 ) * c.radius };
+        const glm::vec2 p1 { c.center.x + std::cos( a2 ) * c.radius, c.center.y + std::sin( a2 ) * c.radius };
+
+        switch ( fillMode )
+        {
+        case FillMode::WireFrame:
+            drawLine( p0, p1, color, blendMode );
+            break;
+        case FillMode::Solid:
+            drawTriangle( p0, p1, c.center, color, blendMode, fillMode );
+            break;
+        }
+    }
+}
+
+void ImageView::drawSprite( const Sprite& sprite, const glm::mat3& matrix ) noexcept
+{
+    // Sample from a view of the sprite so that texels outside of the sprite's rectangle are never sampled.
+    const ImageView image = sprite.getView();
+    if ( !image )
+        return;
+
+    // If the top-left area of the matrix is identity, then there is no rotation or scale.
+    // In this case, use the fast-path to draw the sprite.
+    if ( glm::isIdentity( glm::mat2 { matrix }, 0.0001f ) )
+    {
+        const int x = static_cast<int>( matrix[2][0] );
+        const int y = static_cast<int>( matrix[2][1] );
+
+        drawSprite( sprite, x, y );
+        return;
+    }
+
+    const Color      color     = sprite.getColor();
+    const BlendMode  blendMode = sprite.getBlendMode();
+    const glm::ivec2 size { image.getWidth(), image.getHeight() };
+
+    // Texture coordinates are relative to the sprite view.
+    Vertex verts[] = {
+        Vertex { { 0, 0 }, { 0, 0 }, color },                                      // Top-left
+        Vertex { { size.x - 1, 0 }, { size.x - 1, 0 }, color },                    // Top-right
+        Vertex { { size.x - 1, size.y - 1 }, { size.x - 1, size.y - 1 }, color },  // Bottom-right
+        Vertex { { 0, size.y - 1 }, { 0, size.y - 1 }, color }                     // Bottom-left
+    };
+
+    // Transform verts.
+    for ( Vertex& v: verts )
+    {
+        v.position = matrix * glm::vec3 { v.position, 1.0f };
+    }
+
+    // Compute an AABB over the sprite quad.
+    AABB aabb {
+        { verts[0].position, 0.0f },
+        { verts[1].position, 0.0f },
+        { verts[2].position, 0.0f },
+        { verts[3].position, 0.0f }
+    };
+
+    // Check if the AABB of the sprite is on screen.
+    if ( !m_AABB.intersect( aabb ) )
+        return;
+
+    // Clamp to the size of the screen.
+    aabb.clamp( m_AABB );
+
+    // Index buffer for the two triangles of the quad.
+    const uint32_t indicies[] = {
+        0, 1, 3,
+        1, 2, 3
+    };
+
+#pragma omp parallel for schedule( dynamic ) firstprivate( aabb, indicies, verts, color, blendMode, image )
+    for ( int y = static_cast<int>( aabb.min.y ); y <= static_cast<int>( aabb.max.y ); ++y )
+    {
+        for ( int x = static_cast<int>( aabb.min.x ); x <= static_cast<int>( aabb.max.x ); ++x )
+        {
+            for ( uint32_t i = 0; i < std::size( indicies ); i += 3 )
+            {
+                const uint32_t i0 = indicies[i + 0];
+                const uint32_t i1 = indicies[i + 1];
+                const uint32_t i2 = indicies[i + 2];
+
+                glm::vec3 bc = barycentric( verts[i0].position, verts[i1].position, verts[i2].position, { x, y } );
+                if ( barycentricInside( bc ) )
+                {
+                    // Compute interpolated UV
+                    const glm::ivec2 texCoord = round( verts[i0].texCoord * bc.x + verts[i1].texCoord * bc.y + verts[i2].texCoord * bc.z );
+                    // Sample the sprite's texture.
+                    const Color c = image.sample( texCoord.x, texCoord.y, AddressMode::Clamp ) * color;
+                    // Plot.
+                    plot<false>( static_cast<uint32_t>( x ), static_cast<uint32_t>( y ), c, blendMode );
+                }
+            }
+        }
+    }
+}
+
+void ImageView::drawSprite( const Sprite& sprite, int x, int y ) noexcept
+{
+    const ImageView image = sprite.getView();
+    if ( !image )
+        return;
+
+    const Color     color     = sprite.getColor();
+    const BlendMode blendMode = sprite.getBlendMode();
+
+    // Source sprite coords
+    const int sX = x < 0 ? -x : 0;
+    const int sY = y < 0 ? -y : 0;
+    const int sW = static_cast<int>( image.getWidth() ) - sX;
+    const int sH = static_cast<int>( image.getHeight() ) - sY;
+
+    // Check if the sprite is offscreen.
+    if ( sW <= 0 || sH <= 0 )
+        return;
+
+    // Destination coords.
+    const int dX = x < 0 ? 0 : x;
+    const int dY = y < 0 ? 0 : y;
+    const int dW = static_cast<int>( m_width ) - dX;
+    const int dH = static_cast<int>( m_height ) - dY;
+
+    // Check if the destination region is offscreen.
+    if ( dW <= 0 || dH <= 0 )
+        return;
+
+    // Source image stride.
+    const int iS = static_cast<int>( image.getStride() );
+
+    // The destination copy region is the minimum of the source
+    // and destination dimensions.
+    const int w = std::min( sW, dW );
+    const int h = std::min( sH, dH );
+
+    const Color* src = image.data() + static_cast<size_t>( sY ) * iS + sX;
+    Color*       dst = m_data + static_cast<size_t>( dY ) * m_stride + dX;
+
+#pragma omp parallel for firstprivate( w, h, iS, color, blendMode )
+    for ( int y = 0; y < h; ++y )
+    {
+        const Color* s = src + static_cast<size_t>( y ) * iS;
+        Color*       d = dst + static_cast<size_t>( y ) * m_stride;
+
+        for ( int x = 0; x < w; ++x )
+            d[x] = blendMode.Blend( s[x] * color, d[x] );
+    }
+}
+
+namespace
+{
+// A sprite instance that passed culling.
+struct SpriteDraw
+{
+    // A view of the sprite in the sprite sheet image.
+    ImageView image;
+    // The inverse transform (screen space to sprite space) for affine instances.
+    glm::mat3 invTransform;
+    Color     color;
+    BlendMode blendMode;
+    // Top-left corner of the sprite on the screen (for axis-aligned instances).
+    int x, y;
+    // Screen space bounds of the sprite clamped to the image (inclusive).
+    int minX, minY, maxX, maxY;
+    bool flipX, flipY;
+    bool affine;
+};
+
+// Draw the rows [y0...y1] of an axis-aligned sprite instance.
+void blitSpriteRows( ImageView& dst, const SpriteDraw& d, int y0, int y1 ) noexcept
+{
+    const int w = static_cast<int>( d.image.getWidth() );
+    const int h = static_cast<int>( d.image.getHeight() );
+
+    for ( int y = y0; y <= y1; ++y )
+    {
+        const int    sy  = d.flipY ? h - 1 - ( y - d.y ) : y - d.y;
+        const Color* src = &d.image( 0, sy );
+        Color*       row = &dst( 0, y );
+
+        if ( d.flipX )
+        {
+            for ( int x = d.minX; x <= d.maxX; ++x )
+                row[x] = d.blendMode.Blend( src[w - 1 - ( x - d.x )] * d.color, row[x] );
+        }
+        else
+        {
+            for ( int x = d.minX; x <= d.maxX; ++x )
+                row[x] = d.blendMode.Blend( src[x - d.x] * d.color, row[x] );
+        }
+    }
+}
+
+// Draw the rows [y0...y1] of an affine sprite instance by sampling through the inverse transform.
+void sampleSpriteRows( ImageView& dst, const SpriteDraw& d, int y0, int y1 ) noexcept
+{
+    const int w = static_cast<int>( d.image.getWidth() );
+    const int h = static_cast<int>( d.image.getHeight() );
+
+    // The change in sprite space coordinates per pixel step in the x-axis.
+    const glm::vec2 dUV { d.invTransform[0] };
+
+    for ( int y = y0; y <= y1; ++y )
+    {
+        glm::vec2 uv = d.invTransform * glm::vec3 { static_cast<float>( d.minX ), static_cast<float>( y ), 1.0f };
+        Color*    row = &dst( 0, y );
+
+        for ( int x = d.minX; x <= d.maxX; ++x, uv += dUV )
+        {
+            int u = static_cast<int>( std::round( uv.x ) );
+            int v = static_cast<int>( std::round( uv.y ) );
+
+            if ( u < 0 || u >= w || v < 0 || v >= h )
+                continue;
+
+            if ( d.flipX )
+                u = w - 1 - u;
+            if ( d.flipY )
+                v = h - 1 - v;
+
+            row[x] = d.blendMode.Blend( d.image( u, v ) * d.color, row[x] );
+        }
+    }
+}
+}  // namespace
+
+void ImageView::drawSprites( const SpriteSheet& sheet, std::span<const SpriteInstance> instances )
+{
+    if ( !m_data || instances.empty() )
+        return;
+
+    // Cull instances against the image bounds.
+    std::vector<SpriteDraw> draws;
+    draws.reserve( instances.size() );
+
+    for ( const SpriteInstance& instance: instances )
+    {
+        const ImageView image = sheet.getView( instance.spriteId );
+        if ( !image )
+            continue;
+
+        const int w = static_cast<int>( image.getWidth() );
+        const int h = static_cast<int>( image.getHeight() );
+
+        SpriteDraw d;
+        d.image     = image;
+        d.color     = instance.color * sheet.getSprite( instance.spriteId ).getColor();
+        d.blendMode = sheet.getSprite( instance.spriteId ).getBlendMode();
+        d.flipX     = ( instance.flip & SpriteFlip::Horizontal ) != 0;
+        d.flipY     = ( instance.flip & SpriteFlip::Vertical ) != 0;
+        d.affine    = !glm::isIdentity( glm::mat2 { instance.transform }, 0.0001f );
+
+        AABB aabb;
+        if ( d.affine )
+        {
+            if ( std::abs( glm::determinant( glm::mat2 { instance.transform } ) ) < 1e-6f )
+                continue;
+
+            d.invTransform = glm::inverse( instance.transform );
+
+            const glm::vec2 p0 = instance.transform * glm::vec3 { 0, 0, 1 };
+            const glm::vec2 p1 = instance.transform * glm::vec3 { w - 1, 0, 1 };
+            const glm::vec2 p2 = instance.transform * glm::vec3 { w - 1, h - 1, 1 };
+            const glm::vec2 p3 = instance.transform * glm::vec3 { 0, h - 1, 1 };
+
+            aabb = AABB { { p0, 0 }, { p1, 0 }, { p2, 0 }, { p3, 0 } };
+        }
+        else
+        {
+            d.x  = static_cast<int>( instance.transform[2][0] );
+            d.y  = static_cast<int>( instance.transform[2][1] );
+            aabb = AABB { { d.x, d.y, 0 }, { d.x + w - 1, d.y + h - 1, 0 } };
+        }
+
+        if ( !m_AABB.intersect( aabb ) )
+            continue;
+
+        aabb.clamp( m_AABB );
+
+        d.minX = static_cast<int>( aabb.min.x );
+        d.minY = static_cast<int>( aabb.min.y );
+        d.maxX = static_cast<int>( aabb.max.x );
+        d.maxY = static_cast<int>( aabb.max.y );
+
+        draws.push_back( d );
+    }
+
+    if ( draws.empty() )
+        return;
+
+    // Bin the visible instances into horizontal bands.
+    // Instances are binned in submission order, so each band is drawn back-to-front.
+    const int numBands = ( static_cast<int>( m_height ) + detail::BandHeight - 1 ) / detail::BandHeight;
+
+    std::vector<uint32_t> bandOffsets;
+    std::vector<uint32_t> bandDraws;
+    detail::binIntoBands( draws, numBands, bandOffsets, bandDraws );
+
+    // Render each band on a separate thread.
+#pragma omp parallel for schedule( dynamic )
+    for ( int b = 0; b < numBands; ++b )
+    {
+        const int bandMinY = b * detail::BandHeight;
+        const int bandMaxY = bandMinY + detail::BandHeight - 1;
+
+        for ( uint32_t i = bandOffsets[b]; i < bandOffsets[b + 1]; ++i )
+        {
+            const SpriteDraw& d  = draws[bandDraws[i]];
+            const int         y0 = std::max( d.minY, bandMinY );
+            const int         y1 = std::min( d.maxY, bandMaxY );
+
+            if ( d.affine )
+                sampleSpriteRows( *this, d, y0, y1 );
+            else
+                blitSpriteRows( *this, d, y0, y1 );
+        }
+    }
+}
+
+void ImageView::setupTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, std::vector<detail::TriangleSetup>& triangles ) const
+{
+    triangles.clear();
+
+    if ( !m_data || vertices.empty() || indices.size() < 3 )
+        return;
+
+    // Snap the vertices to the fixed-point grid once.
+    std::vector<glm::i64vec2> positions( vertices.size() );
+    for ( size_t i = 0; i < vertices.size(); ++i )
+        positions[i] = glm::i64vec2 { glm::round( vertices[i].position * static_cast<float>( detail::SubPixelScale ) ) };
+
+    triangles.reserve( indices.size() / 3 );
+
+    for ( size_t i = 0; i + 2 < indices.size(); i += 3 )
+    {
+        detail::TriangleSetup t;
+        t.i0 = indices[i + 0];
+        t.i1 = indices[i + 1];
+        t.i2 = indices[i + 2];
+
+        if ( t.i0 >= vertices.size() || t.i1 >= vertices.size() || t.i2 >= vertices.size() )
+            continue;
+
+        // Make the winding order consistent so the inside of the triangle is on the positive side of each edge.
+        int64_t area = detail::EdgeFunction { positions[t.i0], positions[t.i1] }( positions[t.i2].x, positions[t.i2].y );
+        if ( area == 0 )
+            continue;
+
+        if ( area < 0 )
+        {
+            std::swap( t.i1, t.i2 );
+            area = -area;
+        }
+
+        const glm::i64vec2& p0 = positions[t.i0];
+        const glm::i64vec2& p1 = positions[t.i1];
+        const glm::i64vec2& p2 = positions[t.i2];
+
+        AABB aabb { { vertices[t.i0].position, 0 }, { vertices[t.i1].position, 0 }, { vertices[t.i2].position, 0 } };
+        if ( !m_AABB.intersect( aabb ) )
+            continue;
+
+        aabb.clamp( m_AABB );
+
+        t.e0      = detail::EdgeFunction { p1, p2 };
+        t.e1      = detail::EdgeFunction { p2, p0 };
+        t.e2      = detail::EdgeFunction { p0, p1 };
+        t.invArea = 1.0f / static_cast<float>( area );
+        t.minX    = static_cast<int>( std::floor( aabb.min.x ) );
+        t.minY    = static_cast<int>( std::floor( aabb.min.y ) );
+        t.maxX    = static_cast<int>( std::ceil( aabb.max.x ) );
+        t.maxY    = static_cast<int>( std::ceil( aabb.max.y ) );
+
+        triangles.push_back( t );
+    }
+}
+
+void ImageView::drawTriangles( std::span<const Vertex> vertices, std::span<const uint32_t> indices, const ImageView& texture, AddressMode addressMode, const BlendMode& blendMode )
+{
+    if ( !texture )
+        return;
+
+    drawTriangles( vertices, indices, TextureShader { texture, addressMode, blendMode } );
+}
+
+void ImageView::drawText( const Font& font, std::string_view text, int x, int y, const Color& color )
+{
+    // Reuse the glyph buffer between calls to avoid allocating memory every time text is drawn.
+    thread_local std::vector<Glyph> glyphs;
+    Math::RectI                     bounds;
+
+    glyphs.clear();
+    font.layout( text, glyphs, bounds );
+    drawGlyphs( font, glyphs, x, y, color );
+}
+
+void ImageView::drawText( const Font& font, std::wstring_view text, int x, int y, const Color& color )
+{
+    thread_local std::vector<Glyph> glyphs;
+    Math::RectI                     bounds;
+
+    glyphs.clear();
+    font.layout( text, glyphs, bounds );
+    drawGlyphs( font, glyphs, x, y, color );
+}
+
+void ImageView::drawText( const TextLayout& layout, int x, int y, const Color& color )
+{
+    if ( const Font* font = layout.getFont() )
+        drawGlyphs( *font, layout.getGlyphs(), x, y, color );
+}
+
+void ImageView::drawText( const TextLayout& layout, int x, int y, const TextStyle& style )
+{
+    if ( const Font* font = layout.getFont() )
+        drawGlyphs( *font, layout.getGlyphs(), x, y, style );
+}
+
+void ImageView::drawGlyphs( const Font& font, std::span<const Glyph> glyphs, int x, int y, const Color& color )
+{
+    if ( font.getMode() == FontMode::SDF )
+    {
+        drawGlyphs( font, glyphs, x, y, TextStyle { color } );
+        return;
+    }
+
+    GlyphAtlas&    atlas  = GlyphAtlas::getShared();
+    const uint8_t* pixels = atlas.data();
+    const size_t   stride = atlas.getWidth();
+    const int      w      = static_cast<int>( m_width );
+    const int      h      = static_cast<int>( m_height );
+
+    for ( const Glyph& glyph: glyphs )
+    {
+        if ( glyph.slot == GlyphAtlas::InvalidSlot )
+            continue;
+
+        // Cached layouts keep their glyphs from being evicted.
+        atlas.touch( glyph.slot );
+
+        // Clip the glyph against the image.
+        const int dx0 = std::max( glyph.dst.left + x, 0 );
+        const int dy0 = std::max( glyph.dst.top + y, 0 );
+        const int dx1 = std::min( glyph.dst.right() + x, w );
+        const int dy1 = std::min( glyph.dst.bottom() + y, h );
+
+        if ( dx0 >= dx1 || dy0 >= dy1 )
+            continue;
+
+        // Offset from destination pixels to atlas pixels.
+        const Math::RectI& src = atlas.getEntry( glyph.slot ).rect;
+        const int          sx  = src.left - ( glyph.dst.left + x );
+        const int          sy  = src.top - ( glyph.dst.top + y );
+
+        for ( int dy = dy0; dy < dy1; ++dy )
+        {
+            const uint8_t* coverage = pixels + static_cast<size_t>( dy + sy ) * stride + sx;
+            Color*         dst      = m_data + static_cast<size_t>( dy ) * m_stride;
+
+            for ( int dx = dx0; dx < dx1; ++dx )
+            {
+                const uint8_t a = static_cast<uint8_t>( coverage[dx] * color.a / 255 );
+                if ( a == 0 )
+                    continue;
+
+                dst[dx] = a == 255 ? color : BlendMode::AlphaBlend.Blend( color.withAlpha( a ), dst[dx] );
+            }
+        }
+    }
+}
+
+void ImageView::drawGlyphs( const Font& font, std::span<const Glyph> glyphs, int x, int y, const TextStyle& style )
+{
+    if ( font.getMode() != FontMode::SDF )
+    {
+        // Bitmap fonts are blitted without scaling, so only the shadow is supported.
+        if ( style.shadowColor.a > 0 )
+            drawGlyphs( font, glyphs, x + static_cast<int>( std::lround( style.shadowOffset.x ) ), y + static_cast<int>( std::lround( style.shadowOffset.y ) ), style.shadowColor );
+
+        drawGlyphs( font, glyphs, x, y, style.color );
+        return;
+    }
+
+    GlyphAtlas&     atlas = GlyphAtlas::getShared();
+    const glm::vec2 origin { static_cast<float>( x ), static_cast<float>( y ) };
+    const glm::vec2 invSize { 1.0f / static_cast<float>( atlas.getWidth() ), 1.0f / static_cast<float>( atlas.getHeight() ) };
+
+    // Build a quad for every glyph so the text is rasterized with a single call to drawTriangles.
+    // The buffers are reused between calls to avoid allocating memory every time text is drawn.
+    thread_local std::vector<Vertex>   vertices;
+    thread_local std::vector<uint32_t> indices;
+
+    vertices.clear();
+    indices.clear();
+
+    for ( const Glyph& glyph: glyphs )
+    {
+        if ( glyph.slot == GlyphAtlas::InvalidSlot )
+            continue;
+
+        atlas.touch( glyph.slot );
+
+        const Math::RectI& rect = atlas.getEntry( glyph.slot ).rect;
+
+        const glm::vec2 p0  = origin + glm::vec2 { glyph.dst.left, glyph.dst.top } * style.scale;
+        const glm::vec2 p1  = origin + glm::vec2 { glyph.dst.right(), glyph.dst.bottom() } * style.scale;
+        const glm::vec2 uv0 = glm::vec2 { rect.left, rect.top } * invSize;
+        const glm::vec2 uv1 = glm::vec2 { rect.right(), rect.bottom() } * invSize;
+
+        const auto i = static_cast<uint32_t>( vertices.size() );
+
+        vertices.emplace_back( p0, uv0, style.color );
+        vertices.emplace_back( glm::vec2 { p1.x, p0.y }, glm::vec2 { uv1.x, uv0.y }, style.color );
+        vertices.emplace_back( p1, uv1, style.color );
+        vertices.emplace_back( glm::vec2 { p0.x, p1.y }, glm::vec2 { uv0.x, uv1.y }, style.color );
+
+        indices.insert( indices.end(), { i + 0, i + 1, i + 3, i + 1, i + 2, i + 3 } );
+    }
+
+    if ( indices.empty() )
+        return;
+
+    // Convert normalized distance field values to pixels at the scale the text is drawn.
+    const float onEdge        = static_cast<float>( Font::SDFOnEdgeValue ) / 255.0f;
+    const float distanceScale = 255.0f / Font::SDFPixelDistScale * style.scale;
+
+    if ( style.shadowColor.a > 0 )
+    {
+        thread_local std::vector<Vertex> shadow;
+
+        shadow.assign( vertices.begin(), vertices.end() );
+        for ( auto& v: shadow )
+        {
+            v.position += style.shadowOffset;
+            v.color = style.shadowColor;
+        }
+
+        // The shadow includes the outline.
+        drawTriangles( shadow, indices, SDFShader { atlas, onEdge, distanceScale, style.outlineWidth, style.shadowColor, style.shadowSoftness } );
+    }
+
+    drawTriangles( vertices, indices, SDFShader { atlas, onEdge, distanceScale, style.outlineWidth, style.outlineColor } );
+}
+
+constexpr int fast_floor( float x ) noexcept
+{
+    return static_cast<int>( static_cast<double>( x ) + 1073741823.0 ) - 1073741823;
+}
+
+constexpr int fast_mod( int x, int y ) noexcept
+{
+    return x - y * fast_floor( static_cast<float>( x ) / static_cast<float>( y ) );
+}
+
+const Color& ImageView::sample( int u, int v, AddressMode addressMode ) const noexcept
+{
+    const int w = static_cast<int>( m_width );
+    const int h = static_cast<int>( m_height );
+
+    switch ( addressMode )
+    {
+    case AddressMode::Wrap:
+    {
+        u = fast_mod( u, w );
+        v = fast_mod( v, h );
+    }
+    break;
+    case AddressMode::Mirror:
+    {
+        u = u / w % 2 == 0 ? fast_mod( u, w ) : ( w - 1 ) - fast_mod( u, w );
+        v = v / h % 2 == 0 ? fast_mod( v, h ) : ( h - 1 ) - fast_mod( v, h );
+    }
+    break;
+    case AddressMode::Clamp:
+    {
+        u = std::clamp( u, 0, w - 1 );
+        v = std::clamp( v, 0, h - 1 );
+    }
+    break;
+    }
+
+    assert( u >= 0 && u < w );
+    assert( v >= 0 && v < h );
+
+    return m_data[static_cast<uint64_t>( v ) * m_stride + u];
+}
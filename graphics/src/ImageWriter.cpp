@@ -0,0 +1,118 @@
+#include <Graphics/ImageWriter.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Graphics;
+
+ImageWriter::ImageWriter( size_t maxQueued )
+: maxQueued { std::max<size_t>( maxQueued, 1u ) }
+, thread { &ImageWriter::worker, this }
+{}
+
+ImageWriter::~ImageWriter()
+{
+    {
+        std::scoped_lock lock { mutex };
+        stop = true;
+    }
+
+    requestAvailable.notify_all();
+    thread.join();
+}
+
+ImageWriter& ImageWriter::getShared()
+{
+    static ImageWriter writer;
+    return writer;
+}
+
+bool ImageWriter::save( const ImageView& image, const std::filesystem::path& file, bool wait )
+{
+    if ( !image )
+        return false;
+
+    Image snapshot;
+    {
+        std::unique_lock lock { mutex };
+
+        if ( wait )
+            requestFinished.wait( lock, [this] { return queue.size() + writing < maxQueued; } );
+        else if ( queue.size() + writing >= maxQueued )
+            return false;
+
+        // Reserve the slot while the pixels are copied.
+        ++writing;
+
+        if ( !pool.empty() )
+        {
+            snapshot = std::move( pool.back() );
+            pool.pop_back();
+        }
+    }
+
+    const uint32_t width  = image.getWidth();
+    const uint32_t height = image.getHeight();
+
+    // Does nothing if the pooled buffer is already the right size (which is the usual case for screenshots).
+    snapshot.resize( width, height );
+
+    if ( image.getStride() == width )
+    {
+        std::memcpy( snapshot.data(), image.data(), static_cast<size_t>( width ) * height * sizeof( Color ) );
+    }
+    else
+    {
+        for ( uint32_t y = 0; y < height; ++y )
+            std::memcpy( snapshot.data() + static_cast<size_t>( y ) * width, image.data() + static_cast<size_t>( y ) * image.getStride(), width * sizeof( Color ) );
+    }
+
+    {
+        std::scoped_lock lock { mutex };
+        --writing;
+        queue.push_back( { std::move( snapshot ), file } );
+    }
+
+    requestAvailable.notify_one();
+
+    return true;
+}
+
+void ImageWriter::flush()
+{
+    std::unique_lock lock { mutex };
+    requestFinished.wait( lock, [this] { return queue.empty() && writing == 0u; } );
+}
+
+size_t ImageWriter::getNumQueued() const
+{
+    std::scoped_lock lock { mutex };
+    return queue.size() + writing;
+}
+
+void ImageWriter::worker()
+{
+    std::unique_lock lock { mutex };
+
+    while ( true )
+    {
+        requestAvailable.wait( lock, [this] { return stop || !queue.empty(); } );
+
+        // Queued images are written before the writer is destroyed.
+        if ( queue.empty() )
+            return;
+
+        Request request = std::move( queue.front() );
+        queue.pop_front();
+        ++writing;
+
+        lock.unlock();
+        request.image.save( request.file );
+        lock.lock();
+
+        --writing;
+        pool.push_back( std::move( request.image ) );
+
+        requestFinished.notify_all();
+    }
+}
@@ -0,0 +1,154 @@
+#include <Graphics/InputLatency.hpp>
+
+#include <Graphics/BlendMode.hpp>
+#include <Graphics/Color.hpp>
+#include <Graphics/Font.hpp>
+#include <Graphics/ImageView.hpp>
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+using namespace Graphics;
+
+namespace
+{
+using Ticks = InputLatency::Clock::rep;
+
+constexpr Ticks NoInput = 0;
+
+// The oldest input that has not been consumed by Input::update (in clock ticks).
+std::atomic<Ticks> g_PendingInput { NoInput };
+
+// The oldest input consumed by the current frame.
+Ticks g_FrameInput = NoInput;
+
+// The latencies of the last MaxSamples measured frames (in milliseconds).
+std::array<double, InputLatency::MaxSamples>   g_Samples {};
+size_t                                         g_NumSamples = 0u;
+size_t                                         g_NextSample = 0u;
+std::array<uint32_t, InputLatency::NumBuckets> g_Histogram {};
+
+size_t getBucket( double latency ) noexcept
+{
+    return std::min( static_cast<size_t>( std::max( latency, 0.0 ) / InputLatency::BucketWidth ), InputLatency::NumBuckets - 1 );
+}
+
+void addSample( double latency ) noexcept
+{
+    // Once the window is full, the oldest sample is replaced.
+    if ( g_NumSamples == InputLatency::MaxSamples )
+        --g_Histogram[getBucket( g_Samples[g_NextSample] )];
+    else
+        ++g_NumSamples;
+
+    g_Samples[g_NextSample] = latency;
+    ++g_Histogram[getBucket( latency )];
+
+    g_NextSample = ( g_NextSample + 1 ) % InputLatency::MaxSamples;
+}
+}  // namespace
+
+void InputLatency::notifyInput( Clock::time_point time ) noexcept
+{
+    const Ticks ticks = std::max<Ticks>( time.time_since_epoch().count(), NoInput + 1 );
+
+    // Keep the oldest input (the input thread and the game thread can both report input).
+    Ticks pending = g_PendingInput.load( std::memory_order_relaxed );
+    while ( ( pending == NoInput || ticks < pending ) && !g_PendingInput.compare_exchange_weak( pending, ticks, std::memory_order_relaxed ) )
+    {}
+}
+
+void InputLatency::beginFrame() noexcept
+{
+    const Ticks pending = g_PendingInput.exchange( NoInput, std::memory_order_relaxed );
+
+    // If the previous frame was never presented, its input is still waiting to be presented.
+    if ( pending != NoInput && ( g_FrameInput == NoInput || pending < g_FrameInput ) )
+        g_FrameInput = pending;
+}
+
+void InputLatency::discardInput() noexcept
+{
+    g_PendingInput.store( NoInput, std::memory_order_relaxed );
+}
+
+void InputLatency::endFrame() noexcept
+{
+    if ( g_FrameInput == NoInput )
+        return;
+
+    const auto latency = Clock::now() - Clock::time_point { Clock::duration { g_FrameInput } };
+    addSample( std::chrono::duration<double, std::milli>( latency ).count() );
+
+    g_FrameInput = NoInput;
+}
+
+void InputLatency::reset() noexcept
+{
+    g_NumSamples = 0u;
+    g_NextSample = 0u;
+    g_Histogram.fill( 0u );
+}
+
+InputLatency::Stats InputLatency::getStats()
+{
+    if ( g_NumSamples == 0u )
+        return {};
+
+    std::array<double, MaxSamples> samples;
+    std::copy_n( g_Samples.begin(), g_NumSamples, samples.begin() );
+    std::sort( samples.begin(), samples.begin() + static_cast<ptrdiff_t>( g_NumSamples ) );
+
+    const auto percentile = [&]( double p ) {
+        return samples[std::min( static_cast<size_t>( p * static_cast<double>( g_NumSamples ) ), g_NumSamples - 1 )];
+    };
+
+    double sum = 0.0;
+    for ( size_t i = 0; i < g_NumSamples; ++i )
+        sum += samples[i];
+
+    return Stats {
+        .count = g_NumSamples,
+        .min   = samples[0],
+        .mean  = sum / static_cast<double>( g_NumSamples ),
+        .p50   = percentile( 0.50 ),
+        .p95   = percentile( 0.95 ),
+        .p99   = percentile( 0.99 ),
+        .max   = samples[g_NumSamples - 1],
+    };
+}
+
+std::span<const uint32_t, InputLatency::NumBuckets> InputLatency::getHistogram() noexcept
+{
+    return g_Histogram;
+}
+
+void InputLatency::drawOverlay( ImageView& image, int x, int y )
+{
+    constexpr int BarWidth  = 3;
+    constexpr int MaxHeight = 40;
+
+    const Stats stats      = getStats();
+    const int   lineHeight = static_cast<int>( Font::Default.getLineHeight() );
+    const int   width      = static_cast<int>( NumBuckets ) * BarWidth;
+
+    image.drawText( Font::Default, fmt::format( "Input latency: {:.1f} ms (p95 {:.1f}, p99 {:.1f}, max {:.1f})", stats.p50, stats.p95, stats.p99, stats.max ), x, y, Color::Black );
+    y += lineHeight;
+
+    image.drawRectangle( Math::RectI { x, y, width, MaxHeight }, Color { 0, 0, 0, 128 }, BlendMode::AlphaBlend );
+
+    const uint32_t maxCount = std::max( *std::ranges::max_element( g_Histogram ), 1u );
+    for ( size_t i = 0; i < NumBuckets; ++i )
+    {
+        const int height = static_cast<int>( g_Histogram[i] * MaxHeight / maxCount );
+        if ( height > 0 )
+            image.drawRectangle( Math::RectI { x + static_cast<int>( i ) * BarWidth, y + MaxHeight - height, BarWidth - 1, height }, Color::Green );
+    }
+
+    // Mark the median.
+    const int median = x + static_cast<int>( getBucket( stats.p50 ) ) * BarWidth;
+    image.drawLine( median, y, median, y + MaxHeight - 1, Color::Red );
+}
@@ -0,0 +1,214 @@
+#include "InputRecording.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <span>
+
+using namespace Graphics;
+
+namespace
+{
+constexpr uint32_t Magic   = 0x52504E49;  // "INPR"
+constexpr uint32_t Version = 1u;
+
+struct Header
+{
+    uint32_t magic;
+    uint32_t version;
+    // The layout of the device states. Recordings can only be replayed by a build with the same layout.
+    uint32_t keyboardSize;
+    uint32_t mouseSize;
+    uint32_t gamePadSize;
+    uint32_t numGamePads;
+};
+
+Header makeHeader() noexcept
+{
+    return Header {
+        .magic        = Magic,
+        .version      = Version,
+        .keyboardSize = static_cast<uint32_t>( sizeof( KeyboardState ) ),
+        .mouseSize    = static_cast<uint32_t>( sizeof( MouseState ) ),
+        .gamePadSize  = static_cast<uint32_t>( sizeof( GamePadState ) ),
+        .numGamePads  = static_cast<uint32_t>( GamePad::MAX_PLAYERS ),
+    };
+}
+
+// The device states of a frame in the order they are recorded (bit i of the change mask of a record refers to block i).
+struct Block
+{
+    size_t offset;
+    size_t size;
+};
+
+constexpr auto getBlocks() noexcept
+{
+    std::array<Block, 2 + GamePad::MAX_PLAYERS> blocks {};
+
+    blocks[0] = { offsetof( InputFrame, keyboard ), sizeof( KeyboardState ) };
+    blocks[1] = { offsetof( InputFrame, mouse ), sizeof( MouseState ) };
+    for ( size_t i = 0; i < GamePad::MAX_PLAYERS; ++i )
+        blocks[2 + i] = { offsetof( InputFrame, gamePads ) + i * sizeof( GamePadState ), sizeof( GamePadState ) };
+
+    return blocks;
+}
+
+constexpr auto Blocks = getBlocks();
+
+static_assert( Blocks.size() <= 8, "The change mask of a record is a single byte." );
+
+void writeVarint( std::vector<std::byte>& out, uint64_t value )
+{
+    while ( value >= 0x80 )
+    {
+        out.push_back( static_cast<std::byte>( value | 0x80 ) );
+        value >>= 7;
+    }
+
+    out.push_back( static_cast<std::byte>( value ) );
+}
+
+bool readVarint( std::span<const std::byte> data, size_t& position, uint64_t& value ) noexcept
+{
+    value = 0u;
+    for ( int shift = 0; shift < 64; shift += 7 )
+    {
+        if ( position >= data.size() )
+            return false;
+
+        const auto b = static_cast<uint64_t>( data[position++] );
+        value |= ( b & 0x7F ) << shift;
+
+        if ( ( b & 0x80 ) == 0 )
+            return true;
+    }
+
+    return false;
+}
+}  // namespace
+
+InputFrame::InputFrame() noexcept
+{
+    // Records compare the bytes of the device states (including padding), so frames must start out zeroed.
+    std::memset( static_cast<void*>( this ), 0, sizeof( InputFrame ) );
+}
+
+InputRecorder::InputRecorder( const std::filesystem::path& file )
+: stream { file, std::ios::binary | std::ios::trunc }
+{
+    if ( !stream )
+    {
+        std::cerr << "ERROR: Could not create input recording: " << file.string() << std::endl;
+        return;
+    }
+
+    const Header header = makeHeader();
+    stream.write( reinterpret_cast<const char*>( &header ), sizeof( Header ) );
+}
+
+void InputRecorder::write( const InputFrame& frame )
+{
+    const auto* current = reinterpret_cast<const std::byte*>( &frame );
+    const auto* last    = reinterpret_cast<const std::byte*>( &lastFrame );
+
+    record.clear();
+    writeVarint( record, frame.frameTime );
+
+    const size_t maskPosition = record.size();
+    uint8_t      mask         = 0u;
+    record.push_back( std::byte { 0 } );
+
+    // Each changed block is stored as the number of changed bytes followed by (distance to the previous change, new value) pairs.
+    for ( size_t i = 0; i < Blocks.size(); ++i )
+    {
+        const auto [offset, size] = Blocks[i];
+
+        size_t numChanged = 0u;
+        for ( size_t j = 0; j < size; ++j )
+            numChanged += current[offset + j] != last[offset + j];
+
+        if ( numChanged == 0u )
+            continue;
+
+        mask |= static_cast<uint8_t>( 1u << i );
+        writeVarint( record, numChanged );
+
+        size_t previous = 0u;
+        for ( size_t j = 0; j < size; ++j )
+        {
+            if ( current[offset + j] == last[offset + j] )
+                continue;
+
+            writeVarint( record, j - previous );
+            record.push_back( current[offset + j] );
+            previous = j;
+        }
+    }
+
+    record[maskPosition] = static_cast<std::byte>( mask );
+
+    stream.write( reinterpret_cast<const char*>( record.data() ), static_cast<std::streamsize>( record.size() ) );
+    std::memcpy( static_cast<void*>( &lastFrame ), &frame, sizeof( InputFrame ) );
+}
+
+InputReplay::InputReplay( const std::filesystem::path& path )
+: file { path }
+{
+    Header header {};
+    if ( file.size() >= sizeof( Header ) )
+        std::memcpy( &header, file.data(), sizeof( Header ) );
+
+    const Header expected = makeHeader();
+    if ( header.magic != expected.magic || header.version != expected.version || header.keyboardSize != expected.keyboardSize ||
+         header.mouseSize != expected.mouseSize || header.gamePadSize != expected.gamePadSize || header.numGamePads != expected.numGamePads )
+    {
+        std::cerr << "ERROR: Invalid input recording (or recorded by an incompatible build): " << path.string() << std::endl;
+        file = MappedFile {};
+        return;
+    }
+
+    position = sizeof( Header );
+}
+
+bool InputReplay::read( InputFrame& frame )
+{
+    const auto data = file.getData();
+    auto*      last = reinterpret_cast<std::byte*>( &lastFrame );
+
+    uint64_t frameTime = 0u;
+    if ( !readVarint( data, position, frameTime ) || position >= data.size() )
+        return false;
+
+    const auto mask = static_cast<uint8_t>( data[position++] );
+
+    for ( size_t i = 0; i < Blocks.size(); ++i )
+    {
+        if ( ( mask & ( 1u << i ) ) == 0 )
+            continue;
+
+        const auto [offset, size] = Blocks[i];
+
+        uint64_t numChanged = 0u;
+        if ( !readVarint( data, position, numChanged ) || numChanged > size )
+            return false;
+
+        size_t index = 0u;
+        for ( uint64_t j = 0; j < numChanged; ++j )
+        {
+            uint64_t distance = 0u;
+            if ( !readVarint( data, position, distance ) || distance >= size - index || position >= data.size() )
+                return false;
+
+            index += static_cast<size_t>( distance );
+            last[offset + index] = data[position++];
+        }
+    }
+
+    lastFrame.frameTime = frameTime;
+    std::memcpy( static_cast<void*>( &frame ), &lastFrame, sizeof( InputFrame ) );
+    ++frameCount;
+
+    return true;
+}
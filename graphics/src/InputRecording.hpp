@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Graphics/GamePad.hpp>
+#include <Graphics/GamePadState.hpp>
+#include <Graphics/KeyboardState.hpp>
+#include <Graphics/MappedFile.hpp>
+#include <Graphics/MouseState.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// Recording and replaying of the raw device states that are read by Input::update.
+// A recording is a header followed by one record per frame. Each record stores the frame time and only the bytes of the
+// device states that changed since the previous frame, so an idle frame only takes a few bytes.
+namespace Graphics
+{
+/// <summary>
+/// The device states of a single frame.
+/// </summary>
+struct InputFrame
+{
+    InputFrame() noexcept;
+
+    uint64_t      frameTime;  // The time since the previous frame (in nanoseconds).
+    KeyboardState keyboard;
+    MouseState    mouse;
+    GamePadState  gamePads[GamePad::MAX_PLAYERS];
+};
+
+/// <summary>
+/// Writes the frames of a recording to a file.
+/// </summary>
+class InputRecorder final
+{
+public:
+    explicit InputRecorder( const std::filesystem::path& file );
+
+    explicit operator bool() const noexcept
+    {
+        return stream.good();
+    }
+
+    /// <summary>
+    /// Append a frame to the recording.
+    /// </summary>
+    void write( const InputFrame& frame );
+
+private:
+    std::ofstream          stream;
+    InputFrame             lastFrame;
+    std::vector<std::byte> record;  // Reused for each frame.
+};
+
+/// <summary>
+/// Reads the frames of a recording.
+/// </summary>
+class InputReplay final
+{
+public:
+    explicit InputReplay( const std::filesystem::path& file );
+
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool>( file );
+    }
+
+    /// <summary>
+    /// Read the next frame of the recording.
+    /// </summary>
+    /// <param name="frame">Receives the device states of the frame.</param>
+    /// <returns>`true` if a frame was read, or `false` at the end of the recording (or if the recording is corrupt).</returns>
+    bool read( InputFrame& frame );
+
+    /// <summary>
+    /// Get the number of frames that have been read.
+    /// </summary>
+    uint64_t getFrameCount() const noexcept
+    {
+        return frameCount;
+    }
+
+private:
+    MappedFile file;
+    size_t     position   = 0u;
+    uint64_t   frameCount = 0u;
+    InputFrame lastFrame;
+};
+
+}  // namespace Graphics
@@ -0,0 +1,85 @@
+#include <Graphics/JobPool.hpp>
+
+#include <algorithm>
+
+using namespace Graphics;
+
+JobPool::JobPool( uint32_t numThreads )
+{
+    if ( numThreads == 0u )
+    {
+        // Leave one hardware thread for the render thread.
+        numThreads = std::max( std::thread::hardware_concurrency(), 2u ) - 1u;
+    }
+
+    threads.reserve( numThreads );
+    for ( uint32_t i = 0; i < numThreads; ++i )
+        threads.emplace_back( &JobPool::worker, this );
+}
+
+JobPool::~JobPool()
+{
+    {
+        std::scoped_lock lock { mutex };
+        stop = true;
+    }
+
+    jobAvailable.notify_all();
+
+    for ( auto& thread: threads )
+        thread.join();
+}
+
+JobPool& JobPool::getShared()
+{
+    static JobPool pool;
+    return pool;
+}
+
+void JobPool::wait()
+{
+    std::unique_lock lock { mutex };
+    jobsFinished.wait( lock, [this] { return jobs.empty() && running == 0u; } );
+}
+
+size_t JobPool::getNumPending() const
+{
+    std::scoped_lock lock { mutex };
+    return jobs.size() + running;
+}
+
+void JobPool::enqueue( std::function<void()> job )
+{
+    {
+        std::scoped_lock lock { mutex };
+        jobs.push_back( std::move( job ) );
+    }
+
+    jobAvailable.notify_one();
+}
+
+void JobPool::worker()
+{
+    std::unique_lock lock { mutex };
+
+    while ( true )
+    {
+        jobAvailable.wait( lock, [this] { return stop || !jobs.empty(); } );
+
+        // Queued jobs are finished before the pool is destroyed.
+        if ( jobs.empty() )
+            return;
+
+        auto job = std::move( jobs.front() );
+        jobs.pop_front();
+        ++running;
+
+        lock.unlock();
+        job();
+        lock.lock();
+
+        --running;
+        if ( jobs.empty() && running == 0u )
+            jobsFinished.notify_all();
+    }
+}
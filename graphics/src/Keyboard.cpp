@@ -1,8 +1,8 @@
-#include <Graphics/Keyboard.hpp>
-
-using namespace Graphics;
-
-bool Keyboard::isConnected()
-{
-    return true;
-}
+#include <Graphics/Keyboard.hpp>
+
+using namespace Graphics;
+
+bool Keyboard::isConnected()
+{
+    return true;
+}
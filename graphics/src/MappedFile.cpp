@@ -0,0 +1,133 @@
+#include <Graphics/MappedFile.hpp>
+
+#if defined( _WIN32 )
+    #include "Win32/IncludeWin32.hpp"
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <utility>
+
+using namespace Graphics;
+
+MappedFile::MappedFile( const std::filesystem::path& path, Access access )
+{
+#if defined( _WIN32 )
+    HANDLE handle = CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( handle == INVALID_HANDLE_VALUE )
+        return;
+
+    fileHandle = handle;
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( handle, &size ) || size.QuadPart == 0 )
+    {
+        unmap();
+        return;
+    }
+
+    const bool copyOnWrite = access == Access::CopyOnWrite;
+
+    mappingHandle = CreateFileMappingW( handle, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr );
+    if ( !mappingHandle )
+    {
+        unmap();
+        return;
+    }
+
+    fileData = static_cast<std::byte*>( MapViewOfFile( mappingHandle, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0 ) );
+    if ( !fileData )
+    {
+        unmap();
+        return;
+    }
+
+    fileSize = static_cast<size_t>( size.QuadPart );
+#else
+    fd = open( path.c_str(), O_RDONLY );
+    if ( fd < 0 )
+        return;
+
+    struct stat st {};
+    if ( fstat( fd, &st ) != 0 || st.st_size == 0 )
+    {
+        unmap();
+        return;
+    }
+
+    const int protection = access == Access::CopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+
+    void* ptr = mmap( nullptr, static_cast<size_t>( st.st_size ), protection, MAP_PRIVATE, fd, 0 );
+    if ( ptr == MAP_FAILED )
+    {
+        unmap();
+        return;
+    }
+
+    fileData = static_cast<std::byte*>( ptr );
+    fileSize = static_cast<size_t>( st.st_size );
+#endif
+}
+
+MappedFile::MappedFile( MappedFile&& other ) noexcept
+: fileData { std::exchange( other.fileData, nullptr ) }
+, fileSize { std::exchange( other.fileSize, 0u ) }
+#if defined( _WIN32 )
+, fileHandle { std::exchange( other.fileHandle, nullptr ) }
+, mappingHandle { std::exchange( other.mappingHandle, nullptr ) }
+#else
+, fd { std::exchange( other.fd, -1 ) }
+#endif
+{}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+MappedFile& MappedFile::operator=( MappedFile&& other ) noexcept
+{
+    if ( this == &other )
+        return *this;
+
+    unmap();
+
+    fileData = std::exchange( other.fileData, nullptr );
+    fileSize = std::exchange( other.fileSize, 0u );
+#if defined( _WIN32 )
+    fileHandle    = std::exchange( other.fileHandle, nullptr );
+    mappingHandle = std::exchange( other.mappingHandle, nullptr );
+#else
+    fd = std::exchange( other.fd, -1 );
+#endif
+
+    return *this;
+}
+
+void MappedFile::unmap() noexcept
+{
+#if defined( _WIN32 )
+    if ( fileData )
+        UnmapViewOfFile( fileData );
+    if ( mappingHandle )
+        CloseHandle( mappingHandle );
+    if ( fileHandle )
+        CloseHandle( fileHandle );
+
+    fileHandle    = nullptr;
+    mappingHandle = nullptr;
+#else
+    if ( fileData )
+        munmap( fileData, fileSize );
+    if ( fd >= 0 )
+        close( fd );
+
+    fd = -1;
+#endif
+
+    fileData = nullptr;
+    fileSize = 0u;
+}
@@ -0,0 +1,261 @@
+#include "QOI.hpp"
+
+#include <array>
+#include <cstring>
+
+using namespace Graphics;
+
+namespace
+{
+constexpr uint8_t OpIndex = 0x00;  // 00xxxxxx
+constexpr uint8_t OpDiff  = 0x40;  // 01xxxxxx
+constexpr uint8_t OpLuma  = 0x80;  // 10xxxxxx
+constexpr uint8_t OpRun   = 0xC0;  // 11xxxxxx
+constexpr uint8_t OpRGB   = 0xFE;  // 11111110
+constexpr uint8_t OpRGBA  = 0xFF;  // 11111111
+constexpr uint8_t OpMask  = 0xC0;
+
+constexpr size_t HeaderSize = 14u;
+constexpr size_t MaxRun     = 62u;
+
+constexpr uint8_t EndMarker[] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+// The same limit as the reference implementation, so the size of the pixel buffer can't overflow.
+constexpr uint64_t MaxPixels = 400'000'000u;
+
+// The seen-pixels index starts out zeroed (including alpha).
+using PixelIndex = std::array<Color, 64>;
+
+uint32_t hash( const Color& c ) noexcept
+{
+    return ( c.r * 3u + c.g * 5u + c.b * 7u + c.a * 11u ) % 64u;
+}
+
+uint32_t readBE32( const uint8_t* p ) noexcept
+{
+    return static_cast<uint32_t>( p[0] ) << 24 | static_cast<uint32_t>( p[1] ) << 16 | static_cast<uint32_t>( p[2] ) << 8 | p[3];
+}
+
+void writeBE32( uint8_t* p, uint32_t v ) noexcept
+{
+    p[0] = static_cast<uint8_t>( v >> 24 );
+    p[1] = static_cast<uint8_t>( v >> 16 );
+    p[2] = static_cast<uint8_t>( v >> 8 );
+    p[3] = static_cast<uint8_t>( v );
+}
+}  // namespace
+
+bool QOI::readHeader( std::span<const std::byte> data, uint32_t& width, uint32_t& height ) noexcept
+{
+    if ( data.size() < HeaderSize + sizeof( EndMarker ) )
+        return false;
+
+    const auto* p = reinterpret_cast<const uint8_t*>( data.data() );
+    if ( std::memcmp( p, "qoif", 4 ) != 0 )
+        return false;
+
+    width  = readBE32( p + 4 );
+    height = readBE32( p + 8 );
+
+    const uint8_t channels   = p[12];
+    const uint8_t colorspace = p[13];
+
+    return width > 0u && height > 0u && static_cast<uint64_t>( width ) * height <= MaxPixels && ( channels == 3u || channels == 4u ) && colorspace <= 1u;
+}
+
+bool QOI::decode( std::span<const std::byte> data, Color* pixels, uint32_t stride ) noexcept
+{
+    uint32_t width, height;
+    if ( !readHeader( data, width, height ) )
+        return false;
+
+    const auto* p = reinterpret_cast<const uint8_t*>( data.data() ) + HeaderSize;
+    // Chunks never overlap the end marker.
+    const auto* end = reinterpret_cast<const uint8_t*>( data.data() ) + data.size() - sizeof( EndMarker );
+
+    PixelIndex index;
+    index.fill( Color { 0u } );
+
+    Color    px { 0, 0, 0, 255 };
+    uint32_t run = 0u;
+
+    for ( uint32_t y = 0; y < height; ++y )
+    {
+        Color* row = pixels + static_cast<size_t>( y ) * stride;
+
+        for ( uint32_t x = 0; x < width; ++x )
+        {
+            if ( run > 0u )
+            {
+                --run;
+                row[x] = px;
+                continue;
+            }
+
+            if ( p >= end )
+                return false;
+
+            const uint8_t b1 = *p++;
+
+            if ( b1 == OpRGB )
+            {
+                if ( end - p < 3 )
+                    return false;
+
+                px.r = p[0];
+                px.g = p[1];
+                px.b = p[2];
+                p += 3;
+            }
+            else if ( b1 == OpRGBA )
+            {
+                if ( end - p < 4 )
+                    return false;
+
+                px.r = p[0];
+                px.g = p[1];
+                px.b = p[2];
+                px.a = p[3];
+                p += 4;
+            }
+            else
+            {
+                switch ( b1 & OpMask )
+                {
+                case OpIndex:
+                    px = index[b1];
+                    break;
+                case OpDiff:
+                    px.r += static_cast<uint8_t>( ( ( b1 >> 4 ) & 0x03 ) - 2 );
+                    px.g += static_cast<uint8_t>( ( ( b1 >> 2 ) & 0x03 ) - 2 );
+                    px.b += static_cast<uint8_t>( ( b1 & 0x03 ) - 2 );
+                    break;
+                case OpLuma:
+                {
+                    if ( p >= end )
+                        return false;
+
+                    const uint8_t b2 = *p++;
+                    const int     vg = ( b1 & 0x3F ) - 32;
+
+                    px.r += static_cast<uint8_t>( vg - 8 + ( ( b2 >> 4 ) & 0x0F ) );
+                    px.g += static_cast<uint8_t>( vg );
+                    px.b += static_cast<uint8_t>( vg - 8 + ( b2 & 0x0F ) );
+                }
+                break;
+                case OpRun:
+                    run = b1 & 0x3F;
+                    break;
+                }
+            }
+
+            index[hash( px )] = px;
+            row[x]            = px;
+        }
+    }
+
+    return true;
+}
+
+std::vector<std::byte> QOI::encode( const Color* pixels, uint32_t width, uint32_t height, uint32_t stride )
+{
+    // Worst case: every pixel is encoded with OpRGBA.
+    std::vector<std::byte> data( HeaderSize + static_cast<size_t>( width ) * height * 5u + sizeof( EndMarker ) );
+
+    auto* p = reinterpret_cast<uint8_t*>( data.data() );
+
+    std::memcpy( p, "qoif", 4 );
+    writeBE32( p + 4, width );
+    writeBE32( p + 8, height );
+    p[12] = 4u;  // RGBA
+    p[13] = 0u;  // sRGB with linear alpha
+    p += HeaderSize;
+
+    PixelIndex index;
+    index.fill( Color { 0u } );
+
+    Color    prev { 0, 0, 0, 255 };
+    uint32_t run = 0u;
+
+    for ( uint32_t y = 0; y < height; ++y )
+    {
+        const Color* row = pixels + static_cast<size_t>( y ) * stride;
+
+        for ( uint32_t x = 0; x < width; ++x )
+        {
+            const Color px = row[x];
+
+            if ( px.argb == prev.argb )
+            {
+                if ( ++run == MaxRun )
+                {
+                    *p++ = static_cast<uint8_t>( OpRun | ( run - 1u ) );
+                    run  = 0u;
+                }
+                continue;
+            }
+
+            if ( run > 0u )
+            {
+                *p++ = static_cast<uint8_t>( OpRun | ( run - 1u ) );
+                run  = 0u;
+            }
+
+            const uint32_t h = hash( px );
+            if ( index[h].argb == px.argb )
+            {
+                *p++ = static_cast<uint8_t>( OpIndex | h );
+            }
+            else
+            {
+                index[h] = px;
+
+                if ( px.a == prev.a )
+                {
+                    const auto vr  = static_cast<int8_t>( px.r - prev.r );
+                    const auto vg  = static_cast<int8_t>( px.g - prev.g );
+                    const auto vb  = static_cast<int8_t>( px.b - prev.b );
+                    const auto vgr = static_cast<int8_t>( vr - vg );
+                    const auto vgb = static_cast<int8_t>( vb - vg );
+
+                    if ( vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2 )
+                    {
+                        *p++ = static_cast<uint8_t>( OpDiff | ( vr + 2 ) << 4 | ( vg + 2 ) << 2 | ( vb + 2 ) );
+                    }
+                    else if ( vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8 )
+                    {
+                        *p++ = static_cast<uint8_t>( OpLuma | ( vg + 32 ) );
+                        *p++ = static_cast<uint8_t>( ( vgr + 8 ) << 4 | ( vgb + 8 ) );
+                    }
+                    else
+                    {
+                        *p++ = OpRGB;
+                        *p++ = px.r;
+                        *p++ = px.g;
+                        *p++ = px.b;
+                    }
+                }
+                else
+                {
+                    *p++ = OpRGBA;
+                    *p++ = px.r;
+                    *p++ = px.g;
+                    *p++ = px.b;
+                    *p++ = px.a;
+                }
+            }
+
+            prev = px;
+        }
+    }
+
+    if ( run > 0u )
+        *p++ = static_cast<uint8_t>( OpRun | ( run - 1u ) );
+
+    std::memcpy( p, EndMarker, sizeof( EndMarker ) );
+    p += sizeof( EndMarker );
+
+    data.resize( static_cast<size_t>( p - reinterpret_cast<uint8_t*>( data.data() ) ) );
+
+    return data;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Graphics/Color.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// An implementation of the "Quite OK Image Format" (https://qoiformat.org/qoi-specification.pdf).
+// QOI encodes and decodes an order of magnitude faster than PNG, and compresses pixel art to a similar size.
+namespace Graphics::QOI
+{
+/// <summary>
+/// Check if the data starts with a valid QOI header and read the size of the image.
+/// </summary>
+/// <param name="data">The contents of a QOI file.</param>
+/// <param name="width">Receives the width of the image (in pixels).</param>
+/// <param name="height">Receives the height of the image (in pixels).</param>
+/// <returns>`true` if the header is valid.</returns>
+bool readHeader( std::span<const std::byte> data, uint32_t& width, uint32_t& height ) noexcept;
+
+/// <summary>
+/// Decode the pixels of a QOI image.
+/// The header must have been validated with `readHeader`, and the pixel buffer must be large enough for the whole image.
+/// </summary>
+/// <param name="data">The contents of a QOI file.</param>
+/// <param name="pixels">The pixel buffer to decode the image to.</param>
+/// <param name="stride">The distance between rows of the pixel buffer (in pixels).</param>
+/// <returns>`true` if the image was decoded, or `false` if the data is truncated.</returns>
+bool decode( std::span<const std::byte> data, Color* pixels, uint32_t stride ) noexcept;
+
+/// <summary>
+/// Encode pixels as a QOI image (4 channels, sRGB with linear alpha).
+/// </summary>
+/// <param name="pixels">The pixels to encode.</param>
+/// <param name="width">The width of the image (in pixels).</param>
+/// <param name="height">The height of the image (in pixels).</param>
+/// <param name="stride">The distance between rows of pixels (in pixels).</param>
+/// <returns>The contents of the QOI file.</returns>
+std::vector<std::byte> encode( const Color* pixels, uint32_t width, uint32_t height, uint32_t stride );
+}  // namespace Graphics::QOI
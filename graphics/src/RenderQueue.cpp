@@ -0,0 +1,127 @@
+#include <Graphics/ImageView.hpp>
+#include <Graphics/RenderQueue.hpp>
+#include <Graphics/SpriteSheet.hpp>
+
+#include <array>
+#include <bit>
+
+using namespace Graphics;
+
+uint64_t RenderQueue::makeKey( uint8_t layer, float depth, uint32_t sheetId ) noexcept
+{
+    // Map the float to an unsigned integer that sorts in the same order.
+    // Positive floats have the sign bit flipped, negative floats have all bits flipped.
+    uint32_t d = std::bit_cast<uint32_t>( depth );
+    d ^= ( d & 0x80000000u ) ? 0xFFFFFFFFu : 0x80000000u;
+
+    return static_cast<uint64_t>( layer ) << 56 | static_cast<uint64_t>( d ) << 24 | ( sheetId & 0xFFFFFFu );
+}
+
+void RenderQueue::submit( const SpriteSheet& sheet, const SpriteInstance& instance, uint8_t layer, float depth )
+{
+    keys.push_back( makeKey( layer, depth, getSheetId( sheet ) ) );
+    instances.push_back( instance );
+}
+
+void RenderQueue::draw( ImageView& image )
+{
+    if ( keys.empty() )
+        return;
+
+    sort();
+
+    // Submit runs of sprites from the same sprite sheet.
+    size_t i = 0;
+    while ( i < order.size() )
+    {
+        const uint32_t sheetId = static_cast<uint32_t>( sortedKeys[i] & 0xFFFFFFu );
+
+        batch.clear();
+        for ( ; i < order.size() && ( sortedKeys[i] & 0xFFFFFFu ) == sheetId; ++i )
+            batch.push_back( instances[order[i]] );
+
+        image.drawSprites( *sheets[sheetId], batch );
+    }
+}
+
+void RenderQueue::clear() noexcept
+{
+    sheets.clear();
+    keys.clear();
+    instances.clear();
+    lastSheetId = 0u;
+}
+
+uint32_t RenderQueue::getSheetId( const SpriteSheet& sheet )
+{
+    // Consecutive submissions usually come from the same sprite sheet.
+    if ( lastSheetId < sheets.size() && sheets[lastSheetId] == &sheet )
+        return lastSheetId;
+
+    // There are usually only a few sprite sheets per frame, so a linear search is fine.
+    for ( uint32_t i = 0; i < static_cast<uint32_t>( sheets.size() ); ++i )
+    {
+        if ( sheets[i] == &sheet )
+        {
+            lastSheetId = i;
+            return i;
+        }
+    }
+
+    lastSheetId = static_cast<uint32_t>( sheets.size() );
+    sheets.push_back( &sheet );
+
+    return lastSheetId;
+}
+
+// Stable LSD radix sort (8 bits per pass).
+// Source: https://en.wikipedia.org/wiki/Radix_sort
+void RenderQueue::sort()
+{
+    const size_t n = keys.size();
+
+    order.resize( n );
+    scratch.resize( n );
+    sortedKeys.assign( keys.begin(), keys.end() );
+    scratchKeys.resize( n );
+
+    for ( uint32_t i = 0; i < static_cast<uint32_t>( n ); ++i )
+        order[i] = i;
+
+    // Compute the histograms for all passes at once.
+    std::array<std::array<uint32_t, 256>, 8> histograms {};
+    for ( const uint64_t key: keys )
+    {
+        for ( int pass = 0; pass < 8; ++pass )
+            ++histograms[pass][( key >> ( pass * 8 ) ) & 0xFF];
+    }
+
+    for ( int pass = 0; pass < 8; ++pass )
+    {
+        auto&     histogram = histograms[pass];
+        const int shift     = pass * 8;
+
+        // If every key has the same digit, this pass would not change the order.
+        if ( histogram[( sortedKeys[0] >> shift ) & 0xFF] == n )
+            continue;
+
+        // Convert the histogram to offsets.
+        uint32_t offset = 0u;
+        for ( uint32_t& count: histogram )
+        {
+            const uint32_t c = count;
+            count            = offset;
+            offset += c;
+        }
+
+        for ( size_t i = 0; i < n; ++i )
+        {
+            const uint32_t dst = histogram[( sortedKeys[i] >> shift ) & 0xFF]++;
+            scratchKeys[dst]   = sortedKeys[i];
+            scratch[dst]       = order[i];
+        }
+
+        sortedKeys.swap( scratchKeys );
+        order.swap( scratch );
+    }
+}
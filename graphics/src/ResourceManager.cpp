@@ -1,140 +1,1047 @@
-#include <Graphics/ResourceManager.hpp>
-
-#include <functional> // std::hash
-#include <unordered_map>
-
-using namespace Graphics;
-
-/// <summary>
-/// A key used to uniquely identify a font.
-/// </summary>
-struct FontKey
-{
-    std::filesystem::path fontFile;
-    float                 size;
-    uint32_t              firstChar;
-    uint32_t              numChars;
-
-    bool operator==( const FontKey& other ) const
-    {
-        return fontFile == other.fontFile && size == other.size && firstChar == other.firstChar && numChars == other.numChars;
-    }
-};
-
-// This is stolen from boost.
-template<std::size_t Bits>
-struct hash_mix_impl;
-
-template<>
-struct hash_mix_impl<64>
-{
-    static std::uint64_t mix( std::uint64_t x )
-    {
-        constexpr std::uint64_t m = ( static_cast<std::uint64_t>( 0xe9846af ) << 32 ) + 0x9b1a615d;
-
-        x ^= x >> 32;
-        x *= m;
-        x ^= x >> 32;
-        x *= m;
-        x ^= x >> 28;
-
-        return x;
-    }
-};
-
-template<>
-struct hash_mix_impl<32>
-{
-    static std::uint32_t mix( std::uint32_t x )
-    {
-        constexpr std::uint32_t m1  = 0x21f0aaad;
-        constexpr std::uint32_t m2 = 0x735a2d97;
-
-        x ^= x >> 16;
-        x *= m1;
-        x ^= x >> 15;
-        x *= m2;
-        x ^= x >> 15;
-
-        return x;
-    }
-};
-
-inline std::size_t hash_mix( std::size_t v )
-{
-    return hash_mix_impl<sizeof( std::size_t ) * CHAR_BIT>::mix( v );
-}
-
-template<typename T>
-void hash_combine( std::size_t& seed, const T& v )
-{
-    seed = hash_mix( seed + 0x9e3779b9 + std::hash<T>()( v ) );
-}
-
-// Hasher for a FontKey.
-template<>
-struct std::hash<FontKey>
-{
-    size_t operator()( const FontKey& key ) const noexcept
-    {
-        std::size_t seed = 0;
-
-        hash_combine( seed, key.fontFile );
-        hash_combine( seed, key.size );
-        hash_combine( seed, key.firstChar );
-        hash_combine( seed, key.numChars );
-
-        return seed;
-    }
-};
-
-// Image store.
-static std::unordered_map<std::filesystem::path, std::shared_ptr<Image>> g_ImageMap;
-
-// Font store.
-static std::unordered_map<FontKey, std::shared_ptr<Font>> g_FontMap;
-
-std::shared_ptr<Image> ResourceManager::loadImage( const std::filesystem::path& filePath )
-{
-    const auto iter = g_ImageMap.find( filePath );
-
-    if ( iter == g_ImageMap.end() )
-    {
-        auto image = std::make_shared<Image>( filePath );
-
-        g_ImageMap[filePath] = image;
-
-        return image;
-    }
-
-    return iter->second;
-}
-
-std::shared_ptr<SpriteSheet> ResourceManager::loadSpriteSheet( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth, std::optional<uint32_t> spriteHeight, uint32_t padding, uint32_t margin, const BlendMode& blendMode )
-{
-    auto image = loadImage( filePath );
-    return std::make_shared<SpriteSheet>( image, spriteWidth, spriteHeight, padding, margin, blendMode );
-}
-
-std::shared_ptr<Font> ResourceManager::loadFont( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars )
-{
-    FontKey    key { fontFile, size, firstChar, numChars };
-    const auto iter = g_FontMap.find( key );
-
-    if ( iter == g_FontMap.end() )
-    {
-        auto font = std::make_shared<Font>( fontFile, size, firstChar, numChars );
-
-        g_FontMap[key] = font;
-
-        return font;
-    }
-
-    return iter->second;
-}
-
-void ResourceManager::clear()
-{
-    g_ImageMap.clear();
-    g_FontMap.clear();
-}
+#include <Graphics/AssetPack.hpp>
+#include <Graphics/JobPool.hpp>
+#include <Graphics/MappedFile.hpp>
+#include <Graphics/ResourceManager.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+using namespace Graphics;
+
+template<typename T>
+using Future = std::shared_future<std::shared_ptr<T>>;
+
+using Clock = std::chrono::steady_clock;
+
+// Images are loaded from their path only.
+struct ImageParams
+{};
+
+// The parameters of a sprite sheet.
+struct SheetParams
+{
+    ImageHandle             image;
+    std::optional<uint32_t> spriteWidth;
+    std::optional<uint32_t> spriteHeight;
+    uint32_t                padding;
+    uint32_t                margin;
+    BlendMode               blendMode;
+};
+
+// The parameters of a font.
+struct FontParams
+{
+    float    size;
+    uint32_t firstChar;
+    uint32_t numChars;
+    FontMode mode;
+};
+
+// An asset that has been interned by the resource manager.
+// Slots are never removed, so handles remain valid when their resource is evicted (it is loaded again the next time it is used).
+template<typename T, typename Params>
+struct Slot
+{
+    AssetId               id;
+    std::filesystem::path path;  // The normalized path.
+    Params                params;
+
+    std::shared_ptr<T> resource;
+    Future<T>          pending;           // Valid while the resource is being loaded on the job pool.
+    std::exception_ptr error;             // The exception thrown by the last load on the job pool (if it failed).
+    size_t             bytes    = 0u;     // The memory used by the resource when it was loaded.
+    uint64_t           lastUsed = 0u;     // The value of g_Tick when the resource was last used.
+    bool               pinned   = false;  // Pinned resources are never evicted.
+
+    // Load statistics.
+    uint32_t numLoads = 0u;
+    double   loadTime = 0.0;  // The total time spent loading the resource (in seconds).
+    bool     fromPack = false;
+
+    // Jobs that are submitted to the job pool when the pending load finishes (whether it succeeds or not).
+    std::vector<std::function<void()>> continuations;
+};
+
+// Maps asset IDs to slot indices using open addressing with linear probing.
+// Asset IDs are already hashes, so the low bits are used as the bucket index.
+class AssetIndex
+{
+public:
+    static constexpr uint32_t Empty = ~0u;
+
+    uint32_t find( AssetId id ) const noexcept
+    {
+        if ( buckets.empty() )
+            return Empty;
+
+        for ( size_t i = id.getValue() & mask;; i = ( i + 1 ) & mask )
+        {
+            if ( buckets[i].index == Empty || buckets[i].id == id )
+                return buckets[i].index;
+        }
+    }
+
+    void insert( AssetId id, uint32_t index )
+    {
+        // Keep the load factor below 75%.
+        if ( ( count + 1 ) * 4 > buckets.size() * 3 )
+            grow();
+
+        emplace( id, index );
+        ++count;
+    }
+
+private:
+    struct Bucket
+    {
+        AssetId  id;
+        uint32_t index = Empty;
+    };
+
+    void emplace( AssetId id, uint32_t index ) noexcept
+    {
+        size_t i = id.getValue() & mask;
+        while ( buckets[i].index != Empty )
+            i = ( i + 1 ) & mask;
+
+        buckets[i] = { id, index };
+    }
+
+    void grow()
+    {
+        std::vector<Bucket> old = std::move( buckets );
+
+        buckets.assign( std::max<size_t>( old.size() * 2, 64u ), {} );
+        mask = buckets.size() - 1;
+
+        for ( const Bucket& bucket: old )
+        {
+            if ( bucket.index != Empty )
+                emplace( bucket.id, bucket.index );
+        }
+    }
+
+    std::vector<Bucket> buckets;  // The number of buckets is always a power of 2.
+    size_t              mask  = 0u;
+    size_t              count = 0u;
+};
+
+// The interned assets of one type.
+template<typename T, typename Params>
+struct Store
+{
+    using SlotType = Slot<T, Params>;
+
+    std::deque<SlotType> slots;  // A deque, so references to slots remain valid when more assets are interned.
+    AssetIndex           index;
+
+    size_t budget = 0u;  // The memory budget (in bytes), or 0 for no budget.
+    size_t usage  = 0u;  // The memory used by the loaded resources (in bytes).
+};
+
+using ImageStore = Store<Image, ImageParams>;
+using SheetStore = Store<SpriteSheet, SheetParams>;
+using FontStore  = Store<Font, FontParams>;
+
+static ImageStore g_Images;
+static SheetStore g_Sheets;
+static FontStore  g_Fonts;
+
+// The number of resources that are being loaded on the job pool.
+static size_t g_NumPending = 0u;
+
+// Mounted asset packs. Packs that were mounted last are searched first.
+static std::vector<AssetPack> g_Packs;
+
+// Incremented every time a cached resource is used.
+static uint64_t g_Tick = 0u;
+
+// Protects the resource stores, since background jobs add resources when they finish loading.
+static std::mutex g_Mutex;
+
+static double secondsSince( Clock::time_point start )
+{
+    return std::chrono::duration<double>( Clock::now() - start ).count();
+}
+
+static size_t getMemoryUsage( const Image& image )
+{
+    return static_cast<size_t>( image.getWidth() ) * image.getHeight() * sizeof( Color );
+}
+
+static size_t getMemoryUsage( const SpriteSheet& sheet )
+{
+    // The image is accounted for in the image store.
+    return sizeof( SpriteSheet ) + sheet.getNumSprites() * ( sizeof( Sprite ) + sizeof( Math::RectI ) );
+}
+
+static size_t getMemoryUsage( const Font& font )
+{
+    return font.getMemoryUsage();
+}
+
+static uint64_t packBlendMode( const BlendMode& blendMode )
+{
+    return static_cast<uint64_t>( blendMode.blendEnable ) | static_cast<uint64_t>( blendMode.srcFactor ) << 8 | static_cast<uint64_t>( blendMode.dstFactor ) << 16 |
+           static_cast<uint64_t>( blendMode.blendOp ) << 24 | static_cast<uint64_t>( blendMode.srcAlphaFactor ) << 32 |
+           static_cast<uint64_t>( blendMode.dstAlphaFactor ) << 40 | static_cast<uint64_t>( blendMode.alphaOp ) << 48;
+}
+
+// Find the slot of an asset, or add a new slot for it.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static uint32_t intern( Store<T, Params>& store, AssetId id, const std::filesystem::path& path, const Params& params )
+{
+    if ( const uint32_t index = store.index.find( id ); index != AssetIndex::Empty )
+        return index;
+
+    const auto index = static_cast<uint32_t>( store.slots.size() );
+
+    auto& slot  = store.slots.emplace_back();
+    slot.id     = id;
+    slot.path   = path.lexically_normal();
+    slot.params = params;
+
+    store.index.insert( id, index );
+
+    return index;
+}
+
+// Mark a cached resource as the most recently used.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static std::shared_ptr<T> touch( Slot<T, Params>& slot )
+{
+    slot.lastUsed = ++g_Tick;
+    return slot.resource;
+}
+
+// Get the resources that are not pinned and not referenced outside of the store (least recently used first).
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static std::vector<Slot<T, Params>*> getEvictable( Store<T, Params>& store )
+{
+    std::vector<Slot<T, Params>*> candidates;
+    for ( auto& slot: store.slots )
+    {
+        // Only the store references the resource, so no other thread can get a new reference without locking g_Mutex.
+        if ( slot.resource && !slot.pinned && slot.resource.use_count() == 1 )
+            candidates.push_back( &slot );
+    }
+
+    std::ranges::sort( candidates, {}, []( const auto* slot ) { return slot->lastUsed; } );
+
+    return candidates;
+}
+
+// Release the resource of a slot and return the number of bytes that were freed.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static size_t release( Store<T, Params>& store, Slot<T, Params>& slot ) noexcept
+{
+    const size_t bytes = slot.bytes;
+
+    store.usage -= bytes;
+    slot.resource.reset();
+    slot.bytes = 0u;
+
+    return bytes;
+}
+
+// Evict resources that are not pinned and not referenced outside of the store (least recently used first)
+// until the store uses at most `target` bytes.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static size_t evict( Store<T, Params>& store, size_t target )
+{
+    if ( store.usage <= target )
+        return 0u;
+
+    size_t freed = 0u;
+    for ( auto* slot: getEvictable( store ) )
+    {
+        if ( store.usage <= target )
+            break;
+
+        freed += release( store, *slot );
+    }
+
+    return freed;
+}
+
+// Evict unused resources if the store is over budget.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static size_t trim( Store<T, Params>& store )
+{
+    if ( store.budget == 0u || store.usage <= store.budget )
+        return 0u;
+
+    size_t freed = evict( store, store.budget );
+
+    // Sprite sheets keep their images alive. If the unused images don't free enough memory, release unused sheets
+    // (least recently used first) until the images they referenced bring the store back within its budget.
+    if constexpr ( std::is_same_v<T, Image> )
+    {
+        for ( auto* sheet: getEvictable( g_Sheets ) )
+        {
+            if ( store.usage <= store.budget )
+                break;
+
+            freed += release( g_Sheets, *sheet );
+            freed += evict( store, store.budget );
+        }
+    }
+
+    return freed;
+}
+
+// Store a loaded resource in its slot (unless another thread loaded it first) and return the cached resource.
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static std::shared_ptr<T> insert( Store<T, Params>& store, Slot<T, Params>& slot, std::shared_ptr<T> resource, double loadTime, bool fromPack )
+{
+    ++slot.numLoads;
+    slot.loadTime += loadTime;
+    slot.fromPack = fromPack;
+
+    if ( !slot.resource )
+    {
+        slot.bytes    = getMemoryUsage( *resource );
+        slot.resource = std::move( resource );
+        store.usage += slot.bytes;
+    }
+
+    // The returned reference keeps the new resource from being evicted.
+    auto cached = touch( slot );
+    trim( store );
+
+    return cached;
+}
+
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static void setPinned( Store<T, Params>& store, const std::shared_ptr<T>& resource, bool pinned )
+{
+    for ( auto& slot: store.slots )
+    {
+        if ( slot.resource == resource )
+        {
+            slot.pinned = pinned;
+            return;
+        }
+    }
+}
+
+// g_Mutex must be locked by the caller.
+template<typename T, typename Params>
+static ResourceUsage getUsage( const Store<T, Params>& store )
+{
+    ResourceUsage usage;
+    usage.bytes  = store.usage;
+    usage.budget = store.budget;
+
+    for ( const auto& slot: store.slots )
+    {
+        if ( !slot.resource )
+            continue;
+
+        ++usage.numResources;
+        usage.numInUse += slot.resource.use_count() > 1 ? 1u : 0u;
+        usage.numPinned += slot.pinned ? 1u : 0u;
+    }
+
+    return usage;
+}
+
+// Find an asset in the mounted asset packs.
+// g_Mutex must be locked by the caller.
+static std::pair<const AssetPack*, const AssetPack::Entry*> findInPacks( AssetId id, AssetType type )
+{
+    for ( auto pack = g_Packs.rbegin(); pack != g_Packs.rend(); ++pack )
+    {
+        if ( const AssetPack::Entry* entry = pack->find( id, type ) )
+            return { &*pack, entry };
+    }
+
+    return { nullptr, nullptr };
+}
+
+// Images in asset packs are stored pre-decoded, so they can be loaded without a background job.
+// g_Mutex must be locked by the caller.
+static std::shared_ptr<Image> loadImageFromPacks( ImageStore::SlotType& slot )
+{
+    const auto [pack, entry] = findInPacks( slot.id, AssetType::Image );
+    if ( !pack )
+        return nullptr;
+
+    const auto start = Clock::now();
+    auto       image = pack->loadImage( *entry );
+
+    return insert( g_Images, slot, std::move( image ), secondsSince( start ), true );
+}
+
+// Use the slicing parameters from the asset pack if the sprite size is not specified.
+// g_Mutex must be locked by the caller.
+static void findSpriteSheetInfo( SheetParams& params )
+{
+    if ( params.spriteWidth || params.spriteHeight )
+        return;
+
+    if ( const auto [pack, entry] = findInPacks( params.image.getId(), AssetType::SpriteSheet ); pack )
+    {
+        const auto& info    = pack->getSpriteSheetInfo( *entry );
+        params.spriteWidth  = info.spriteWidth;
+        params.spriteHeight = info.spriteHeight;
+        params.padding      = info.padding;
+        params.margin       = info.margin;
+    }
+}
+
+// Run the body of a job that loads a resource on the job pool.
+// Whether the load succeeds or throws, the slot stops being pending and the jobs that wait for it are submitted.
+// If the load throws, the exception is stored in the slot (for the load report) and rethrown to the future.
+template<typename T, typename Params, typename Load>
+static std::shared_ptr<T> runLoadJob( Store<T, Params>& store, Slot<T, Params>& slot, bool fromPack, Load&& load )
+{
+    const auto start = Clock::now();
+
+    std::shared_ptr<T> resource;
+    std::exception_ptr error;
+    try
+    {
+        resource = load();
+    }
+    catch ( ... )
+    {
+        error = std::current_exception();
+    }
+
+    std::scoped_lock lock { g_Mutex };
+    slot.pending = {};
+    slot.error   = error;
+    --g_NumPending;
+
+    std::vector<std::function<void()>> continuations;
+    continuations.swap( slot.continuations );
+    for ( auto& continuation: continuations )
+        JobPool::getShared().submit( std::move( continuation ) );
+
+    if ( error )
+        std::rethrow_exception( error );
+
+    return insert( store, slot, std::move( resource ), secondsSince( start ), fromPack );
+}
+
+// Wrap a resource that is already loaded in a future.
+template<typename T>
+static Future<T> makeReady( std::shared_ptr<T> resource )
+{
+    std::promise<std::shared_ptr<T>> promise;
+    promise.set_value( std::move( resource ) );
+
+    return promise.get_future().share();
+}
+
+// Find an image that is loaded or being loaded, or start loading it on the job pool.
+// g_Mutex must be locked by the caller.
+static Future<Image> findOrLoadImage( ImageStore::SlotType& slot )
+{
+    if ( slot.resource )
+        return makeReady( touch( slot ) );
+
+    if ( slot.pending.valid() )
+        return slot.pending;
+
+    if ( auto image = loadImageFromPacks( slot ) )
+        return makeReady( std::move( image ) );
+
+    // Slots are never removed, so the job can keep a reference to the slot.
+    auto job = [&slot] {
+        return runLoadJob( g_Images, slot, false, [&slot] { return std::make_shared<Image>( slot.path ); } );
+    };
+
+    slot.pending = JobPool::getShared().submit( std::move( job ) ).share();
+    ++g_NumPending;
+
+    return slot.pending;
+}
+
+// Load a font, unless it is already loaded or being loaded.
+// g_Mutex must be locked by the caller.
+static Future<Font> findOrLoadFont( FontStore::SlotType& slot )
+{
+    if ( slot.resource )
+        return makeReady( touch( slot ) );
+
+    if ( slot.pending.valid() )
+        return slot.pending;
+
+    // The job keeps a copy of the asset pack, so the pack stays mapped even if it is unmounted.
+    // Fonts in asset packs are found by the ID of their path (the ID of the slot includes the font parameters).
+    std::optional<AssetPack> pack;
+    const AssetPack::Entry*  entry = nullptr;
+    if ( const auto [p, e] = findInPacks( AssetId { slot.path }, AssetType::Font ); p )
+    {
+        pack  = *p;
+        entry = e;
+    }
+
+    auto job = [&slot, pack = std::move( pack ), entry] {
+        return runLoadJob( g_Fonts, slot, pack.has_value(), [&] {
+            const auto& params = slot.params;
+
+            // The glyph atlas is not thread-safe, so glyphs are rasterized when they are first drawn.
+            return pack ? std::make_shared<Font>( pack->getData( *entry ), pack->getMapping(), params.size, params.firstChar, params.numChars, params.mode, false )
+                        : std::make_shared<Font>( slot.path, params.size, params.firstChar, params.numChars, params.mode, false );
+        } );
+    };
+
+    slot.pending = JobPool::getShared().submit( std::move( job ) ).share();
+    ++g_NumPending;
+
+    return slot.pending;
+}
+
+ImageHandle ResourceManager::getImageHandle( const std::filesystem::path& filePath )
+{
+    const AssetId    id { filePath };
+    std::scoped_lock lock { g_Mutex };
+
+    return ImageHandle { id, intern( g_Images, id, filePath, {} ) };
+}
+
+SheetHandle ResourceManager::getSpriteSheetHandle( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth, std::optional<uint32_t> spriteHeight, uint32_t padding, uint32_t margin, const BlendMode& blendMode )
+{
+    const AssetId imageId { filePath };
+    const AssetId id = imageId.combine( spriteWidth ? *spriteWidth : ~0ull )
+                           .combine( spriteHeight ? *spriteHeight : ~0ull )
+                           .combine( static_cast<uint64_t>( padding ) << 32 | margin )
+                           .combine( packBlendMode( blendMode ) );
+
+    std::scoped_lock lock { g_Mutex };
+
+    const ImageHandle image { imageId, intern( g_Images, imageId, filePath, {} ) };
+
+    return SheetHandle { id, intern( g_Sheets, id, filePath, SheetParams { image, spriteWidth, spriteHeight, padding, margin, blendMode } ) };
+}
+
+FontHandle ResourceManager::getFontHandle( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars, FontMode mode )
+{
+    // The ID of the font file is combined with the parameters of the font, but the hash of the path alone is used to find the font in asset packs.
+    const AssetId id = AssetId { fontFile }.combine( std::bit_cast<uint32_t>( size ) ).combine( static_cast<uint64_t>( firstChar ) << 32 | numChars ).combine( static_cast<uint64_t>( mode ) );
+
+    std::scoped_lock lock { g_Mutex };
+
+    return FontHandle { id, intern( g_Fonts, id, fontFile, FontParams { size, firstChar, numChars, mode } ) };
+}
+
+std::shared_ptr<Image> ResourceManager::get( ImageHandle handle )
+{
+    if ( !handle )
+        return nullptr;
+
+    std::unique_lock lock { g_Mutex };
+    auto&            slot = g_Images.slots[handle.index];
+
+    if ( slot.resource )
+        return touch( slot );
+
+    // Wait for the background job instead of decoding the image twice.
+    if ( slot.pending.valid() )
+    {
+        auto future = slot.pending;
+        lock.unlock();
+
+        return future.get();
+    }
+
+    if ( auto image = loadImageFromPacks( slot ) )
+        return image;
+
+    // Don't block background jobs while the image is decoded.
+    lock.unlock();
+    const auto start = Clock::now();
+    auto       image = std::make_shared<Image>( slot.path );
+    lock.lock();
+
+    return insert( g_Images, slot, std::move( image ), secondsSince( start ), false );
+}
+
+std::shared_ptr<SpriteSheet> ResourceManager::get( SheetHandle handle )
+{
+    if ( !handle )
+        return nullptr;
+
+    std::unique_lock lock { g_Mutex };
+    auto&            slot = g_Sheets.slots[handle.index];
+
+    if ( slot.resource )
+        return touch( slot );
+
+    if ( slot.pending.valid() )
+    {
+        auto future = slot.pending;
+        lock.unlock();
+
+        return future.get();
+    }
+
+    SheetParams params = slot.params;
+    findSpriteSheetInfo( params );
+    lock.unlock();
+
+    auto image = get( params.image );
+
+    const auto start = Clock::now();
+    auto       sheet = std::make_shared<SpriteSheet>( std::move( image ), params.spriteWidth, params.spriteHeight, params.padding, params.margin, params.blendMode );
+
+    lock.lock();
+
+    return insert( g_Sheets, slot, std::move( sheet ), secondsSince( start ), false );
+}
+
+std::shared_ptr<Font> ResourceManager::get( FontHandle handle )
+{
+    if ( !handle )
+        return nullptr;
+
+    std::unique_lock lock { g_Mutex };
+    auto&            slot = g_Fonts.slots[handle.index];
+
+    if ( slot.resource )
+        return touch( slot );
+
+    if ( slot.pending.valid() )
+    {
+        auto future = slot.pending;
+        lock.unlock();
+
+        return future.get();
+    }
+
+    // Fonts are loaded while holding the lock since the glyph atlas is only used on this thread.
+    const auto  start  = Clock::now();
+    const auto& params = slot.params;
+
+    std::shared_ptr<Font> font;
+    bool                  fromPack = false;
+    if ( const auto [pack, entry] = findInPacks( AssetId { slot.path }, AssetType::Font ); pack )
+    {
+        font     = std::make_shared<Font>( pack->getData( *entry ), pack->getMapping(), params.size, params.firstChar, params.numChars, params.mode );
+        fromPack = true;
+    }
+    else
+    {
+        font = std::make_shared<Font>( slot.path, params.size, params.firstChar, params.numChars, params.mode );
+    }
+
+    return insert( g_Fonts, slot, std::move( font ), secondsSince( start ), fromPack );
+}
+
+std::shared_ptr<Image> ResourceManager::loadImage( const std::filesystem::path& filePath )
+{
+    return get( getImageHandle( filePath ) );
+}
+
+std::shared_ptr<SpriteSheet> ResourceManager::loadSpriteSheet( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth, std::optional<uint32_t> spriteHeight, uint32_t padding, uint32_t margin, const BlendMode& blendMode )
+{
+    return get( getSpriteSheetHandle( filePath, spriteWidth, spriteHeight, padding, margin, blendMode ) );
+}
+
+std::shared_ptr<Font> ResourceManager::loadFont( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars, FontMode mode )
+{
+    return get( getFontHandle( fontFile, size, firstChar, numChars, mode ) );
+}
+
+LoadHandle<Image> ResourceManager::loadImageAsync( const std::filesystem::path& filePath, std::shared_ptr<Image> placeholder )
+{
+    const ImageHandle handle = getImageHandle( filePath );
+
+    std::scoped_lock lock { g_Mutex };
+    return LoadHandle<Image> { findOrLoadImage( g_Images.slots[handle.index] ), std::move( placeholder ) };
+}
+
+LoadHandle<SpriteSheet> ResourceManager::loadSpriteSheetAsync( const std::filesystem::path& filePath, std::optional<uint32_t> spriteWidth, std::optional<uint32_t> spriteHeight, uint32_t padding, uint32_t margin, const BlendMode& blendMode, std::shared_ptr<SpriteSheet> placeholder )
+{
+    const SheetHandle handle = getSpriteSheetHandle( filePath, spriteWidth, spriteHeight, padding, margin, blendMode );
+
+    std::scoped_lock lock { g_Mutex };
+    auto&            slot = g_Sheets.slots[handle.index];
+
+    if ( slot.resource )
+        return LoadHandle<SpriteSheet> { makeReady( touch( slot ) ), std::move( placeholder ) };
+
+    if ( slot.pending.valid() )
+        return LoadHandle<SpriteSheet> { slot.pending, std::move( placeholder ) };
+
+    SheetParams params = slot.params;
+    findSpriteSheetInfo( params );
+
+    auto& imageSlot = g_Images.slots[params.image.index];
+    findOrLoadImage( imageSlot );
+
+    auto task = std::make_shared<std::packaged_task<std::shared_ptr<SpriteSheet>()>>( [&slot, params] {
+        return runLoadJob( g_Sheets, slot, false, [&params] {
+            // The image is loaded (or failed to load) by the time this job runs, so this doesn't wait for another job.
+            auto image = ResourceManager::get( params.image );
+            return std::make_shared<SpriteSheet>( std::move( image ), params.spriteWidth, params.spriteHeight, params.padding, params.margin, params.blendMode );
+        } );
+    } );
+
+    slot.pending = task->get_future().share();
+    ++g_NumPending;
+
+    // Don't block a worker thread on the image: if it is still being loaded, submit the sheet job when the image job finishes.
+    auto job = [task] { ( *task )(); };
+    if ( imageSlot.pending.valid() )
+        imageSlot.continuations.emplace_back( std::move( job ) );
+    else
+        JobPool::getShared().submit( std::move( job ) );
+
+    return LoadHandle<SpriteSheet> { slot.pending, std::move( placeholder ) };
+}
+
+LoadHandle<Font> ResourceManager::loadFontAsync( const std::filesystem::path& fontFile, float size, uint32_t firstChar, uint32_t numChars, FontMode mode, std::shared_ptr<Font> placeholder )
+{
+    const FontHandle handle = getFontHandle( fontFile, size, firstChar, numChars, mode );
+
+    std::scoped_lock lock { g_Mutex };
+    return LoadHandle<Font> { findOrLoadFont( g_Fonts.slots[handle.index] ), std::move( placeholder ) };
+}
+
+bool ResourceManager::mountPack( const std::filesystem::path& packFile )
+{
+    AssetPack pack { packFile };
+    if ( !pack.isOpen() )
+        return false;
+
+    std::scoped_lock lock { g_Mutex };
+    g_Packs.push_back( std::move( pack ) );
+
+    return true;
+}
+
+void ResourceManager::unmountPacks()
+{
+    std::scoped_lock lock { g_Mutex };
+    g_Packs.clear();
+}
+
+void ResourceManager::prefetch( std::span<const std::filesystem::path> filePaths )
+{
+    for ( const auto& filePath: filePaths )
+    {
+        const ImageHandle handle = getImageHandle( filePath );
+
+        std::scoped_lock lock { g_Mutex };
+        findOrLoadImage( g_Images.slots[handle.index] );
+    }
+}
+
+FileData ResourceManager::mapFile( const std::filesystem::path& filePath, AssetType type )
+{
+    {
+        std::scoped_lock lock { g_Mutex };
+        if ( const auto [pack, entry] = findInPacks( AssetId { filePath }, type ); pack )
+            return { pack->getData( *entry ), pack->getMapping() };
+    }
+
+    auto file = std::make_shared<const MappedFile>( filePath );
+    if ( !*file )
+        return {};
+
+    return { file->getData(), std::move( file ) };
+}
+
+size_t ResourceManager::getNumPending()
+{
+    std::scoped_lock lock { g_Mutex };
+    return g_NumPending;
+}
+
+void ResourceManager::wait()
+{
+    // Jobs reset the pending futures of their slots before their futures become ready.
+    while ( true )
+    {
+        Future<Image>       image;
+        Future<SpriteSheet> sheet;
+        Future<Font>        font;
+        {
+            std::scoped_lock lock { g_Mutex };
+            if ( g_NumPending == 0u )
+                return;
+
+            const auto findPending = []( const auto& store, auto& future ) {
+                for ( const auto& slot: store.slots )
+                {
+                    if ( slot.pending.valid() )
+                    {
+                        future = slot.pending;
+                        return true;
+                    }
+                }
+
+                return false;
+            };
+
+            findPending( g_Images, image ) || findPending( g_Sheets, sheet ) || findPending( g_Fonts, font );
+        }
+
+        if ( image.valid() )
+            image.wait();
+        else if ( sheet.valid() )
+            sheet.wait();
+        else if ( font.valid() )
+            font.wait();
+    }
+}
+
+void ResourceManager::setBudget( ResourceCategory category, size_t bytes )
+{
+    std::scoped_lock lock { g_Mutex };
+
+    switch ( category )
+    {
+    case ResourceCategory::Image:
+        g_Images.budget = bytes;
+        ::trim( g_Images );
+        break;
+    case ResourceCategory::SpriteSheet:
+        g_Sheets.budget = bytes;
+        ::trim( g_Sheets );
+        break;
+    case ResourceCategory::Font:
+        g_Fonts.budget = bytes;
+        ::trim( g_Fonts );
+        break;
+    }
+}
+
+ResourceUsage ResourceManager::getUsage( ResourceCategory category )
+{
+    std::scoped_lock lock { g_Mutex };
+
+    switch ( category )
+    {
+    case ResourceCategory::Image:
+        return ::getUsage( g_Images );
+    case ResourceCategory::SpriteSheet:
+        return ::getUsage( g_Sheets );
+    case ResourceCategory::Font:
+        return ::getUsage( g_Fonts );
+    }
+
+    return {};
+}
+
+void ResourceManager::pin( const std::shared_ptr<Image>& image, bool pinned )
+{
+    std::scoped_lock lock { g_Mutex };
+    setPinned( g_Images, image, pinned );
+}
+
+void ResourceManager::pin( const std::shared_ptr<Font>& font, bool pinned )
+{
+    std::scoped_lock lock { g_Mutex };
+    setPinned( g_Fonts, font, pinned );
+}
+
+void ResourceManager::pin( ImageHandle handle, bool pinned )
+{
+    if ( !handle )
+        return;
+
+    std::scoped_lock lock { g_Mutex };
+    g_Images.slots[handle.index].pinned = pinned;
+}
+
+void ResourceManager::pin( SheetHandle handle, bool pinned )
+{
+    if ( !handle )
+        return;
+
+    std::scoped_lock lock { g_Mutex };
+    g_Sheets.slots[handle.index].pinned = pinned;
+}
+
+void ResourceManager::pin( FontHandle handle, bool pinned )
+{
+    if ( !handle )
+        return;
+
+    std::scoped_lock lock { g_Mutex };
+    g_Fonts.slots[handle.index].pinned = pinned;
+}
+
+size_t ResourceManager::trim()
+{
+    std::scoped_lock lock { g_Mutex };
+    return ::trim( g_Sheets ) + ::trim( g_Images ) + ::trim( g_Fonts );
+}
+
+size_t ResourceManager::purge()
+{
+    std::scoped_lock lock { g_Mutex };
+
+    // Sheets first, since they keep their images alive.
+    return evict( g_Sheets, 0u ) + evict( g_Images, 0u ) + evict( g_Fonts, 0u );
+}
+
+static std::string getDescription( const ImageStore::SlotType& slot )
+{
+    return slot.path.generic_string();
+}
+
+static std::string getDescription( const SheetStore::SlotType& slot )
+{
+    return fmt::format( "{} ({}x{})", slot.path.generic_string(), slot.params.spriteWidth.value_or( 0u ), slot.params.spriteHeight.value_or( 0u ) );
+}
+
+static std::string getDescription( const FontStore::SlotType& slot )
+{
+    return fmt::format( "{} ({}px)", slot.path.generic_string(), slot.params.size );
+}
+
+// Get the message of an exception that was thrown by a background load.
+static std::string getErrorMessage( const std::exception_ptr& error )
+{
+    if ( !error )
+        return {};
+
+    try
+    {
+        std::rethrow_exception( error );
+    }
+    catch ( const std::exception& e )
+    {
+        return e.what();
+    }
+    catch ( ... )
+    {
+        return "unknown error";
+    }
+}
+
+std::string ResourceManager::getResidencyReport()
+{
+    constexpr double MiB = 1024.0 * 1024.0;
+
+    std::scoped_lock lock { g_Mutex };
+    std::string      report;
+    auto             out = std::back_inserter( report );
+
+    auto printStore = [&]( std::string_view name, const auto& store ) {
+        const ResourceUsage usage = ::getUsage( store );
+
+        fmt::format_to( out, "{}: {} cached, {} in use, {} pinned, {:.2f} MiB", name, usage.numResources, usage.numInUse, usage.numPinned, static_cast<double>( usage.bytes ) / MiB );
+        if ( usage.budget > 0u )
+            fmt::format_to( out, " (budget: {:.2f} MiB)", static_cast<double>( usage.budget ) / MiB );
+        fmt::format_to( out, "\n" );
+
+        std::vector<const typename std::remove_cvref_t<decltype( store )>::SlotType*> slots;
+        for ( const auto& slot: store.slots )
+        {
+            if ( slot.resource )
+                slots.push_back( &slot );
+        }
+
+        std::ranges::sort( slots, std::greater {}, []( const auto* slot ) { return slot->lastUsed; } );
+
+        for ( const auto* slot: slots )
+            fmt::format_to( out, "  {:>9.2f} KiB  {:>3} refs  {:6}  {}\n", static_cast<double>( slot->bytes ) / 1024.0, slot->resource.use_count() - 1, slot->pinned ? "pinned" : "", getDescription( *slot ) );
+    };
+
+    printStore( "Images", g_Images );
+    printStore( "Sprite sheets", g_Sheets );
+    printStore( "Fonts", g_Fonts );
+
+    return report;
+}
+
+std::string ResourceManager::getLoadReport()
+{
+    struct Row
+    {
+        std::string_view type;
+        std::string      description;
+        uint32_t         numLoads;
+        double           loadTime;
+        bool             fromPack;
+        std::string      error;
+    };
+
+    std::vector<Row> rows;
+    {
+        std::scoped_lock lock { g_Mutex };
+
+        auto addRows = [&rows]( std::string_view type, const auto& store ) {
+            for ( const auto& slot: store.slots )
+            {
+                if ( slot.numLoads > 0u || slot.error )
+                    rows.push_back( { type, getDescription( slot ), slot.numLoads, slot.loadTime, slot.fromPack, getErrorMessage( slot.error ) } );
+            }
+        };
+
+        addRows( "image", g_Images );
+        addRows( "sheet", g_Sheets );
+        addRows( "font", g_Fonts );
+    }
+
+    std::ranges::sort( rows, std::greater {}, &Row::loadTime );
+
+    uint32_t numLoads = 0u;
+    double   loadTime = 0.0;
+    for ( const Row& row: rows )
+    {
+        numLoads += row.numLoads;
+        loadTime += row.loadTime;
+    }
+
+    std::string report;
+    auto        out = std::back_inserter( report );
+
+    fmt::format_to( out, "{} assets, {} loads, {:.2f} ms total\n", rows.size(), numLoads, loadTime * 1000.0 );
+    for ( const Row& row: rows )
+    {
+        fmt::format_to( out, "  {:>9.2f} ms  {:>3} loads  {:5}  {:4}  {}\n", row.loadTime * 1000.0, row.numLoads, row.type, row.fromPack ? "pack" : "disk", row.description );
+        if ( !row.error.empty() )
+            fmt::format_to( out, "                 failed: {}\n", row.error );
+    }
+
+    return report;
+}
+
+void ResourceManager::clear()
+{
+    wait();
+
+    std::scoped_lock lock { g_Mutex };
+
+    // Keep the slots, so handles remain valid.
+    auto unload = []( auto& store ) {
+        for ( auto& slot: store.slots )
+        {
+            slot.resource.reset();
+            slot.bytes = 0u;
+        }
+
+        store.usage = 0u;
+    };
+
+    unload( g_Sheets );
+    unload( g_Images );
+    unload( g_Fonts );
+}
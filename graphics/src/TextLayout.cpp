@@ -0,0 +1,44 @@
+#include <Graphics/Font.hpp>
+#include <Graphics/GlyphAtlas.hpp>
+#include <Graphics/TextLayout.hpp>
+
+using namespace Graphics;
+
+TextLayout::TextLayout( const Font& font, std::string_view text, float maxWidth )
+{
+    set( font, text, maxWidth );
+}
+
+void TextLayout::set( const Font& _font, std::string_view _text, float _maxWidth )
+{
+    if ( font == &_font && text == _text && maxWidth == _maxWidth )
+        return;
+
+    font     = &_font;
+    maxWidth = _maxWidth;
+    text.assign( _text );
+
+    update();
+}
+
+void TextLayout::setText( std::string_view _text )
+{
+    if ( font )
+        set( *font, _text, maxWidth );
+    else
+        text.assign( _text );
+}
+
+std::span<const Glyph> TextLayout::getGlyphs() const
+{
+    if ( font && !GlyphAtlas::getShared().isResident( glyphs ) )
+        update();
+
+    return glyphs;
+}
+
+void TextLayout::update() const
+{
+    glyphs.clear();
+    font->layout( text, glyphs, bounds, maxWidth );
+}
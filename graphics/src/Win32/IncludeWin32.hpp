@@ -1,13 +1,13 @@
-#pragma once
-
-#ifndef WIN32_LEAN_AND_MEAN
-    #define WIN32_LEAN_AND_MEAN
-#endif
-#ifndef NOMINMAX
-    #define NOMINMAX
-#endif
-
-#include <ShellScalingApi.h>
-#include <Windows.h>
-#include <comdef.h>
-#include <windowsx.h>
+#pragma once
+
+#ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+    #define NOMINMAX
+#endif
+
+#include <ShellScalingApi.h>
+#include <Windows.h>
+#include <comdef.h>
+#include <windowsx.h>
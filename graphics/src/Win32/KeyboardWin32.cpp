@@ -1,116 +1,118 @@
-#include <Graphics/Keyboard.hpp>
-
-#include "IncludeWin32.hpp"
-
-#include <mutex>
-
-using namespace Graphics;
-
-static_assert( sizeof( KeyboardState ) == 256 / 8 );
-
-// Global keyboard state.
-static KeyboardState state {};
-// Mutex to protect shared access to keyboard state.
-static std::mutex    stateMutex;
-
-KeyboardState Keyboard::getState()
-{
-    std::lock_guard lock( stateMutex );
-
-    state.ShiftKey = state.LeftShift || state.RightShift;
-    state.ControlKey = state.LeftControl || state.RightControl;
-    state.AltKey = state.LeftAlt || state.RightAlt;
-    
-    return state;
-}
-
-void Keyboard::reset()
-{
-    std::lock_guard lock( stateMutex );
-
-    memset( &state, 0, sizeof( KeyboardState ) );
-}
-
-static void keyDown( int key ) noexcept
-{
-    if ( key < 0 || key > 0xfe )
-        return;
-
-    std::lock_guard lock { stateMutex };
-
-    const auto ptr = reinterpret_cast<uint32_t*>( &state );
-
-    const unsigned int bf = 1u << ( key & 0x1f );
-    ptr[( key >> 5 )] |= bf;
-}
-
-static void keyUp( int key ) noexcept
-{
-    if ( key < 0 || key > 0xfe )
-        return;
-
-    std::lock_guard lock { stateMutex };
-
-    const auto ptr = reinterpret_cast<uint32_t*>( &state );
-
-    const unsigned int bf = 1u << ( key & 0x1f );
-    ptr[( key >> 5 )] &= ~bf;
-}
-
-void Keyboard_ProcessMessage( HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam )
-{
-    bool down = false;
-
-    switch ( message )
-    {
-    case WM_ACTIVATE:
-    case WM_ACTIVATEAPP:
-        Keyboard::reset();
-        return;
-
-    case WM_KEYDOWN:
-    case WM_SYSKEYDOWN:
-        down = true;
-        break;
-
-    case WM_KEYUP:
-    case WM_SYSKEYUP:
-        break;
-
-    default:
-        return;
-    }
-
-    int vk = static_cast<int>( wParam );
-    switch ( vk )
-    {
-    case VK_SHIFT:
-        vk = static_cast<int>( MapVirtualKeyW(
-            ( static_cast<UINT>( lParam ) & 0x00ff0000 ) >> 16u, MAPVK_VSC_TO_VK_EX ) );
-        if ( !down )
-        {
-            // Workaround to ensure left vs. right shift get cleared when both were
-            // pressed at the same time.
-            keyUp( VK_LSHIFT );
-            keyUp( VK_RSHIFT );
-        }
-        break;
-
-    case VK_CONTROL:
-        vk = ( static_cast<UINT>( lParam ) & 0x01000000 ) ? VK_RCONTROL : VK_LCONTROL;
-        break;
-
-    case VK_MENU:
-        vk = ( static_cast<UINT>( lParam ) & 0x01000000 ) ? VK_RMENU : VK_LMENU;
-        break;
-    }
-
-    if ( down )
-    {
-        keyDown( vk );
-    }
-    else
-    {
-        keyUp( vk );
-    }
+#include <Graphics/InputLatency.hpp>
+#include <Graphics/Keyboard.hpp>
+
+#include "IncludeWin32.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <iterator>
+
+using namespace Graphics;
+
+static_assert( sizeof( KeyboardState ) == 256 / 8 );
+
+// Global keyboard state (one bit per virtual key).
+// The keys are set and cleared by the thread that receives the window's messages, and read by the game thread. Each
+// word is updated atomically, so the state can be shared without a lock.
+static std::atomic<uint32_t> state[256 / 32] {};
+
+KeyboardState Keyboard::getState()
+{
+    uint32_t keys[256 / 32];
+    for ( size_t i = 0; i < std::size( keys ); ++i )
+        keys[i] = state[i].load( std::memory_order_acquire );
+
+    KeyboardState keyboardState;
+    std::memcpy( &keyboardState, keys, sizeof( KeyboardState ) );
+
+    keyboardState.ShiftKey   = keyboardState.LeftShift || keyboardState.RightShift;
+    keyboardState.ControlKey = keyboardState.LeftControl || keyboardState.RightControl;
+    keyboardState.AltKey     = keyboardState.LeftAlt || keyboardState.RightAlt;
+
+    return keyboardState;
+}
+
+void Keyboard::reset()
+{
+    for ( auto& keys: state )
+        keys.store( 0u, std::memory_order_release );
+}
+
+static void keyDown( int key ) noexcept
+{
+    if ( key < 0 || key > 0xfe )
+        return;
+
+    const unsigned int bf = 1u << ( key & 0x1f );
+    // Key repeats don't change the state, so they are not measured as input.
+    if ( ( state[( key >> 5 )].fetch_or( bf, std::memory_order_acq_rel ) & bf ) == 0 )
+        InputLatency::notifyInput();
+}
+
+static void keyUp( int key ) noexcept
+{
+    if ( key < 0 || key > 0xfe )
+        return;
+
+    const unsigned int bf = 1u << ( key & 0x1f );
+    if ( ( state[( key >> 5 )].fetch_and( ~bf, std::memory_order_acq_rel ) & bf ) != 0 )
+        InputLatency::notifyInput();
+}
+
+void Keyboard_ProcessMessage( HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam )
+{
+    bool down = false;
+
+    switch ( message )
+    {
+    case WM_ACTIVATE:
+    case WM_ACTIVATEAPP:
+        Keyboard::reset();
+        return;
+
+    case WM_KEYDOWN:
+    case WM_SYSKEYDOWN:
+        down = true;
+        break;
+
+    case WM_KEYUP:
+    case WM_SYSKEYUP:
+        break;
+
+    default:
+        return;
+    }
+
+    int vk = static_cast<int>( wParam );
+    switch ( vk )
+    {
+    case VK_SHIFT:
+        vk = static_cast<int>( MapVirtualKeyW(
+            ( static_cast<UINT>( lParam ) & 0x00ff0000 ) >> 16u, MAPVK_VSC_TO_VK_EX ) );
+        if ( !down )
+        {
+            // Workaround to ensure left vs. right shift get cleared when both were
+            // pressed at the same time.
+            keyUp( VK_LSHIFT );
+            keyUp( VK_RSHIFT );
+        }
+        break;
+
+    case VK_CONTROL:
+        vk = ( static_cast<UINT>( lParam ) & 0x01000000 ) ? VK_RCONTROL : VK_LCONTROL;
+        break;
+
+    case VK_MENU:
+        vk = ( static_cast<UINT>( lParam ) & 0x01000000 ) ? VK_RMENU : VK_LMENU;
+        break;
+    }
+
+    if ( down )
+    {
+        keyDown( vk );
+    }
+    else
+    {
+        keyUp( vk );
+    }
 }
\ No newline at end of file
@@ -1,2 +1,11 @@
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
+#include <malloc.h>
+
+// Decode into 64-byte aligned memory (the same alignment as the pixel buffer of an Image),
+// so an Image can take ownership of the decoded pixels instead of copying them.
+// Note: Memory returned by stbi_load must be freed with stbi_image_free (or _aligned_free).
+#define STBI_MALLOC( sz )        _aligned_malloc( sz, 64 )
+#define STBI_REALLOC( p, newsz ) _aligned_realloc( p, newsz, 64 )
+#define STBI_FREE( p )           _aligned_free( p )
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
@@ -1,2 +1,2 @@
-#define STB_TRUETYPE_IMPLEMENTATION
+#define STB_TRUETYPE_IMPLEMENTATION
 #include "stb_truetype.h"
\ No newline at end of file
@@ -0,0 +1,362 @@
+#pragma once
+
+#include "AABB.hpp"
+#include "Circle.hpp"
+#include "Rect.hpp"
+
+#include <glm/common.hpp>
+#include <glm/vec2.hpp>
+
+#include <limits>
+#include <utility>
+
+namespace Math
+{
+
+/// <summary>
+/// A 2D axis-aligned bounding box.
+/// Four floats (16 bytes), so a box fits in a single SSE register. Use this instead of AABB for 2D collision and culling,
+/// and AABB2Array to test many boxes at once.
+/// </summary>
+struct alignas( 16 ) AABB2
+{
+    /// <summary>
+    /// Construct an empty AABB. An empty AABB is not valid and doesn't intersect anything, but it can be expanded.
+    /// </summary>
+    AABB2() noexcept
+    : min { std::numeric_limits<float>::max() }
+    , max { std::numeric_limits<float>::lowest() }
+    {}
+
+    /// <summary>
+    /// Construct an axis-aligned bounding box from 2 points.
+    /// </summary>
+    /// <param name="a">The first point.</param>
+    /// <param name="b">The second point.</param>
+    AABB2( const glm::vec2& a, const glm::vec2& b ) noexcept
+    : min { glm::min( a, b ) }
+    , max { glm::max( a, b ) }
+    {}
+
+    /// <summary>
+    /// Construct a 2D AABB from the x and y components of a 3D AABB.
+    /// </summary>
+    /// <param name="aabb">The 3D AABB.</param>
+    explicit AABB2( const AABB& aabb ) noexcept
+    : min { aabb.min }
+    , max { aabb.max }
+    {}
+
+    /// <summary>
+    /// Convert to a 3D AABB (with a depth of 0).
+    /// </summary>
+    /// <returns>The 3D AABB.</returns>
+    AABB toAABB() const noexcept
+    {
+        return AABB::fromMinMax( { min, 0.0f }, { max, 0.0f } );
+    }
+
+    /// <summary>
+    /// Translate this AABB.
+    /// </summary>
+    /// <param name="rhs">The amount to translate this AABB by.</param>
+    /// <returns>The translated AABB.</returns>
+    AABB2 operator+( const glm::vec2& rhs ) const noexcept
+    {
+        return fromMinMax( min + rhs, max + rhs );
+    }
+
+    /// <summary>
+    /// Translate this AABB.
+    /// </summary>
+    /// <param name="rhs">The amount to translate this AABB by.</param>
+    /// <returns>A reference to this AABB after translation.</returns>
+    AABB2& operator+=( const glm::vec2& rhs ) noexcept
+    {
+        min += rhs;
+        max += rhs;
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Translate this AABB.
+    /// </summary>
+    /// <param name="rhs">The amount to translate this AABB by.</param>
+    /// <returns>The translated AABB.</returns>
+    AABB2 operator-( const glm::vec2& rhs ) const noexcept
+    {
+        return fromMinMax( min - rhs, max - rhs );
+    }
+
+    /// <summary>
+    /// Translate this AABB.
+    /// </summary>
+    /// <param name="rhs">The amount to translate this AABB by.</param>
+    /// <returns>A reference to this AABB after translation.</returns>
+    AABB2& operator-=( const glm::vec2& rhs ) noexcept
+    {
+        min -= rhs;
+        max -= rhs;
+
+        return *this;
+    }
+
+    bool operator==( const AABB2& ) const noexcept = default;
+
+    /// <summary>
+    /// Compute the center point of the AABB.
+    /// </summary>
+    glm::vec2 center() const noexcept
+    {
+        return ( min + max ) * 0.5f;
+    }
+
+    /// <summary>
+    /// Get the width (along the x-axis) of the AABB.
+    /// </summary>
+    float width() const noexcept
+    {
+        return max.x - min.x;
+    }
+
+    /// <summary>
+    /// Get the height (along the y-axis) of the AABB.
+    /// </summary>
+    float height() const noexcept
+    {
+        return max.y - min.y;
+    }
+
+    /// <summary>
+    /// Compute the area of the AABB (width x height).
+    /// </summary>
+    float area() const noexcept
+    {
+        return width() * height();
+    }
+
+    /// <summary>
+    /// Compute the perimeter of the AABB.
+    /// This is the 2D equivalent of the surface area that is used by the surface area heuristic (SAH).
+    /// </summary>
+    float perimeter() const noexcept
+    {
+        return 2.0f * ( width() + height() );
+    }
+
+    /// <summary>
+    /// Compute the size of the AABB.
+    /// </summary>
+    /// <returns>Returns the vector from the min to the max point.</returns>
+    glm::vec2 size() const noexcept
+    {
+        return max - min;
+    }
+
+    /// <summary>
+    /// Compute the extent of the AABB.
+    /// The extent is 1/2 the size of the AABB.
+    /// </summary>
+    glm::vec2 extent() const noexcept
+    {
+        return size() * 0.5f;
+    }
+
+    /// <summary>
+    /// Expand the AABB to include a given point.
+    /// </summary>
+    /// <param name="p">The point to include.</param>
+    AABB2& expand( const glm::vec2& p ) noexcept
+    {
+        min = glm::min( min, p );
+        max = glm::max( max, p );
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Expand this AABB by another AABB.
+    /// </summary>
+    /// <param name="aabb">The other AABB to expand this one.</param>
+    AABB2& expand( const AABB2& aabb ) noexcept
+    {
+        min = glm::min( min, aabb.min );
+        max = glm::max( max, aabb.max );
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Return this AABB grown by a margin on every side.
+    /// </summary>
+    /// <param name="margin">The distance to grow the AABB by (negative values shrink it).</param>
+    AABB2 inflated( float margin ) const noexcept
+    {
+        return fromMinMax( min - margin, max + margin );
+    }
+
+    /// <summary>
+    /// Check to see if another AABB intersects with this one.
+    /// Touching AABBs intersect.
+    /// </summary>
+    /// <param name="aabb">The other AABB to check for intersection.</param>
+    /// <returns>`true` if the AABBs intersect, `false` otherwise.</returns>
+    bool intersect( const AABB2& aabb ) const noexcept
+    {
+        return min.x <= aabb.max.x && min.y <= aabb.max.y && max.x >= aabb.min.x && max.y >= aabb.min.y;
+    }
+
+    /// <summary>
+    /// Test if a line segment intersects this AABB.
+    /// </summary>
+    /// <param name="p0">The beginning of the line segment.</param>
+    /// <param name="p1">The end of the line segment.</param>
+    /// <returns>`true` if the line segment intersects this AABB.</returns>
+    [[nodiscard]] bool intersect( const glm::vec2& p0, const glm::vec2& p1 ) const noexcept
+    {
+        return raycast( p0, p1 - p0, 1.0f ) >= 0.0f;
+    }
+
+    /// <summary>
+    /// Test if a circle is colliding with this AABB.
+    /// </summary>
+    /// <param name="circle">The circle to test.</param>
+    /// <returns>`true` if the circle is colliding with this AABB, `false` otherwise.</returns>
+    [[nodiscard]] bool intersect( const Circle& circle ) const noexcept
+    {
+        const glm::vec2 d = circle.center - glm::clamp( circle.center, min, max );
+        return d.x * d.x + d.y * d.y <= circle.radius * circle.radius;
+    }
+
+    /// <summary>
+    /// Cast a ray against this AABB (slab test).
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The direction of the ray (does not need to be normalized).</param>
+    /// <param name="maxT">(optional) The length of the ray (in multiples of `direction`). Default: infinite.</param>
+    /// <returns>The distance (in multiples of `direction`) along the ray to where it enters the AABB (0 if the origin is
+    /// inside the AABB), or -1 if the ray misses the AABB.</returns>
+    [[nodiscard]] float raycast( const glm::vec2& origin, const glm::vec2& direction, float maxT = std::numeric_limits<float>::infinity() ) const noexcept
+    {
+        float tMin = 0.0f;
+        float tMax = maxT;
+
+        for ( int i = 0; i < 2; ++i )
+        {
+            if ( direction[i] == 0.0f )
+            {
+                // The ray is parallel to the slab, so it must start inside it.
+                if ( origin[i] < min[i] || origin[i] > max[i] )
+                    return -1.0f;
+            }
+            else
+            {
+                const float invD = 1.0f / direction[i];
+                float       t0   = ( min[i] - origin[i] ) * invD;
+                float       t1   = ( max[i] - origin[i] ) * invD;
+                if ( invD < 0.0f )
+                    std::swap( t0, t1 );
+
+                tMin = t0 > tMin ? t0 : tMin;
+                tMax = t1 < tMax ? t1 : tMax;
+
+                if ( tMin > tMax )
+                    return -1.0f;
+            }
+        }
+
+        return tMin;
+    }
+
+    /// <summary>
+    /// Check to see if this is a valid AABB.
+    /// The min point of a valid AABB is less than or equal to the max point.
+    /// </summary>
+    bool isValid() const noexcept
+    {
+        return min.x <= max.x && min.y <= max.y;
+    }
+
+    /// <summary>
+    /// Test whether a point is contained in this AABB.
+    /// </summary>
+    /// <param name="p">The point to test for containment.</param>
+    bool contains( const glm::vec2& p ) const noexcept
+    {
+        return p.x >= min.x && p.y >= min.y && p.x <= max.x && p.y <= max.y;
+    }
+
+    /// <summary>
+    /// Test whether another AABB is completely contained in this AABB.
+    /// </summary>
+    /// <param name="aabb">The AABB to test for containment.</param>
+    bool contains( const AABB2& aabb ) const noexcept
+    {
+        return aabb.min.x >= min.x && aabb.min.y >= min.y && aabb.max.x <= max.x && aabb.max.y <= max.y;
+    }
+
+    /// <summary>
+    /// Construct an AABB from min & max points.
+    /// </summary>
+    /// <param name="min">The min point.</param>
+    /// <param name="max">The max point.</param>
+    static AABB2 fromMinMax( const glm::vec2& min, const glm::vec2& max ) noexcept
+    {
+        AABB2 aabb;
+
+        aabb.min = min;
+        aabb.max = max;
+
+        return aabb;
+    }
+
+    /// <summary>
+    /// Construct an AABB from a rectangle.
+    /// </summary>
+    /// <typeparam name="T">The rectangle type.</typeparam>
+    /// <param name="rect">The rectangle to use to construct an AABB.</param>
+    /// <returns>The AABB that contains the rectangle.</returns>
+    template<typename T>
+    static AABB2 fromRect( const Rect<T>& rect ) noexcept
+    {
+        return fromMinMax( rect.topLeft(), rect.bottomRight() );
+    }
+
+    static AABB2 fromCircle( const Circle& circle ) noexcept
+    {
+        return fromMinMax( circle.min(), circle.max() );
+    }
+
+    /// <summary>
+    /// Construct an AABB that is the union of two AABBs.
+    /// </summary>
+    static AABB2 fromUnion( const AABB2& a, const AABB2& b ) noexcept
+    {
+        return fromMinMax( glm::min( a.min, b.min ), glm::max( a.max, b.max ) );
+    }
+
+    /// <summary>
+    /// Construct an AABB that is the intersection of two AABBs.
+    /// Note: This results in an invalid AABB if the AABBs don't intersect. Use <see cref="AABB2::isValid"/> to test
+    /// if the resulting AABB is valid.
+    /// </summary>
+    static AABB2 fromIntersect( const AABB2& a, const AABB2& b ) noexcept
+    {
+        return fromMinMax( glm::max( a.min, b.min ), glm::min( a.max, b.max ) );
+    }
+
+    /// <summary>
+    /// The minimum point in the AABB.
+    /// </summary>
+    glm::vec2 min;
+
+    /// <summary>
+    /// The maximum point in the AABB.
+    /// </summary>
+    glm::vec2 max;
+};
+
+static_assert( sizeof( AABB2 ) == 16, "AABB2 must fit in a single SSE register." );
+
+}  // namespace Math
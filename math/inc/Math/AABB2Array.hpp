@@ -0,0 +1,171 @@
+#pragma once
+
+#include "AABB2.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Math
+{
+/// <summary>
+/// The instruction set used by the batch kernels of AABB2Array.
+/// </summary>
+enum class SimdLevel
+{
+    Scalar,  ///< One box at a time.
+    SSE,     ///< 4 boxes per instruction (SSE2).
+    AVX2,    ///< 8 boxes per instruction.
+};
+
+/// <summary>
+/// Get the instruction set used by the batch kernels.
+/// The best instruction set that is supported by the CPU is selected when the program starts.
+/// </summary>
+SimdLevel getSimdLevel() noexcept;
+
+/// <summary>
+/// Get the best instruction set that is supported by the CPU.
+/// </summary>
+SimdLevel getSupportedSimdLevel() noexcept;
+
+/// <summary>
+/// Force the batch kernels to use a specific instruction set (for example, to compare the kernels with each other).
+/// </summary>
+/// <param name="level">The instruction set to use. It is limited to the instruction sets that are supported by the CPU.</param>
+/// <returns>The instruction set that will be used.</returns>
+SimdLevel setSimdLevel( SimdLevel level ) noexcept;
+
+/// <summary>
+/// The closest box that was hit by a ray.
+/// </summary>
+struct RayHit
+{
+    uint32_t index;  ///< The index of the box that was hit.
+    float    t;      ///< The distance along the ray (in multiples of the ray direction) to where it enters the box.
+};
+
+/// <summary>
+/// An array of 2D AABBs that is stored as a structure of arrays (all the min x coordinates, then all the min y
+/// coordinates, etc.) so the batch kernels can test 4 (SSE) or 8 (AVX2) boxes per instruction.
+/// </summary>
+class AABB2Array
+{
+public:
+    /// <summary>
+    /// The storage is padded to a multiple of this many boxes so the kernels never need a scalar tail loop.
+    /// </summary>
+    static constexpr size_t Alignment = 8;
+
+    AABB2Array() = default;
+    explicit AABB2Array( std::span<const AABB2> boxes );
+
+    size_t size() const noexcept
+    {
+        return m_Count;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_Count == 0u;
+    }
+
+    void reserve( size_t size );
+    void resize( size_t size );
+    void clear() noexcept;
+
+    void push_back( const AABB2& box );
+
+    /// <summary>
+    /// Replace a box.
+    /// </summary>
+    void set( size_t i, const AABB2& box ) noexcept
+    {
+        m_MinX[i] = box.min.x;
+        m_MinY[i] = box.min.y;
+        m_MaxX[i] = box.max.x;
+        m_MaxY[i] = box.max.y;
+    }
+
+    AABB2 operator[]( size_t i ) const noexcept
+    {
+        return AABB2::fromMinMax( { m_MinX[i], m_MinY[i] }, { m_MaxX[i], m_MaxY[i] } );
+    }
+
+    const float* minX() const noexcept
+    {
+        return m_MinX.data();
+    }
+
+    const float* minY() const noexcept
+    {
+        return m_MinY.data();
+    }
+
+    const float* maxX() const noexcept
+    {
+        return m_MaxX.data();
+    }
+
+    const float* maxY() const noexcept
+    {
+        return m_MaxY.data();
+    }
+
+    /// <summary>
+    /// Find the boxes that intersect a box.
+    /// </summary>
+    /// <param name="box">The box to test against every box in the array.</param>
+    /// <param name="indices">The indices of the boxes that intersect `box` are appended to this vector (in ascending order).</param>
+    /// <returns>The number of boxes that intersect `box`.</returns>
+    size_t overlap( const AABB2& box, std::vector<uint32_t>& indices ) const;
+
+    /// <summary>
+    /// Find the boxes that intersect a line segment.
+    /// </summary>
+    /// <param name="p0">The beginning of the line segment.</param>
+    /// <param name="p1">The end of the line segment.</param>
+    /// <param name="indices">The indices of the boxes that intersect the segment are appended to this vector (in ascending order).</param>
+    /// <returns>The number of boxes that intersect the segment.</returns>
+    size_t overlap( const glm::vec2& p0, const glm::vec2& p1, std::vector<uint32_t>& indices ) const;
+
+    /// <summary>
+    /// Test every box in this array against every box in another array.
+    /// The result is a bit mask for each box in this array: bit j of row i is set if box i intersects box j of `other`.
+    /// </summary>
+    /// <param name="other">The boxes to test against.</param>
+    /// <param name="masks">Receives size() rows of getMaskWords( other.size() ) 64-bit words each.</param>
+    void overlap( const AABB2Array& other, std::span<uint64_t> masks ) const noexcept;
+
+    /// <summary>
+    /// Find the closest box that is hit by a ray.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The direction of the ray (does not need to be normalized).</param>
+    /// <param name="maxT">(optional) The length of the ray (in multiples of `direction`). Default: infinite.</param>
+    /// <returns>The closest hit, or an empty optional if no box is hit.</returns>
+    std::optional<RayHit> raycast( const glm::vec2& origin, const glm::vec2& direction, float maxT = std::numeric_limits<float>::infinity() ) const noexcept;
+
+    /// <summary>
+    /// Get the number of 64-bit words in each row of the pair masks for an array of `size` boxes.
+    /// </summary>
+    static constexpr size_t getMaskWords( size_t size ) noexcept
+    {
+        return ( size + 63 ) / 64;
+    }
+
+private:
+    size_t m_Count = 0u;
+
+    // Each array holds at least m_Count boxes, rounded up to a multiple of Alignment.
+    std::vector<float> m_MinX;
+    std::vector<float> m_MinY;
+    std::vector<float> m_MaxX;
+    std::vector<float> m_MaxY;
+};
+}  // namespace Math
@@ -0,0 +1,352 @@
+#pragma once
+
+#include "AABB2.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Math
+{
+/// <summary>
+/// A dynamic bounding volume hierarchy of 2D AABBs (a broadphase).
+/// Each object in the tree is a proxy (a leaf of the tree) that stores a fattened AABB of the object and some user data.
+/// The AABBs are fattened by a margin (and by the displacement of the object), so objects that move a little don't need
+/// to be reinserted in the tree every frame. Queries return proxies whose fattened AABB intersects the query, so the
+/// caller must test the object itself.
+/// The tree is kept efficient with the surface area heuristic (SAH): new leaves are inserted next to the sibling that
+/// increases the perimeter of the tree the least, and the nodes along the path to the root are rotated if that reduces
+/// the perimeter of the tree.
+/// </summary>
+class AABBTree
+{
+public:
+    /// <summary>
+    /// An invalid proxy (or node).
+    /// </summary>
+    static constexpr int32_t NullNode = -1;
+
+    /// <summary>
+    /// A pair of proxies whose fattened AABBs overlap (proxyA &lt; proxyB).
+    /// </summary>
+    struct Pair
+    {
+        int32_t proxyA;
+        int32_t proxyB;
+
+        bool operator==( const Pair& ) const noexcept = default;
+    };
+
+    /// <summary>
+    /// Construct an empty tree.
+    /// </summary>
+    /// <param name="margin">(optional) The distance the AABBs of inserted and moved proxies are fattened by on every side.</param>
+    /// <param name="displacementMultiplier">(optional) How far ahead (in multiples of the displacement) the AABBs of moved proxies are extended.</param>
+    explicit AABBTree( float margin = 4.0f, float displacementMultiplier = 2.0f ) noexcept;
+
+    /// <summary>
+    /// Remove all the proxies.
+    /// </summary>
+    void clear() noexcept;
+
+    /// <summary>
+    /// Replace the contents of the tree with a tree that is built top-down from a set of AABBs.
+    /// This builds a better tree than inserting the AABBs one at a time. Use it for objects that don't move (like the
+    /// colliders of a level). The AABBs are not fattened.
+    /// After the tree is built, the proxy (and the user data) of aabbs[i] is i.
+    /// </summary>
+    /// <param name="aabbs">The AABBs to build the tree from.</param>
+    void build( std::span<const AABB2> aabbs );
+
+    /// <summary>
+    /// Insert a proxy.
+    /// </summary>
+    /// <param name="aabb">The (tight) AABB of the object.</param>
+    /// <param name="userData">The user data of the proxy (for example, the index of the object).</param>
+    /// <returns>The proxy.</returns>
+    int32_t insert( const AABB2& aabb, uint32_t userData );
+
+    /// <summary>
+    /// Remove a proxy.
+    /// </summary>
+    /// <param name="proxy">The proxy to remove.</param>
+    void remove( int32_t proxy );
+
+    /// <summary>
+    /// Update the AABB of a proxy.
+    /// The proxy is only reinserted in the tree if the new AABB is outside of its fattened AABB (or the fattened AABB
+    /// is much larger than it needs to be).
+    /// </summary>
+    /// <param name="proxy">The proxy to move.</param>
+    /// <param name="aabb">The new (tight) AABB of the object.</param>
+    /// <param name="displacement">(optional) How far the object moved since the last update. It is used to predict where the object will move next.</param>
+    /// <returns>`true` if the proxy was reinserted.</returns>
+    bool move( int32_t proxy, const AABB2& aabb, const glm::vec2& displacement = glm::vec2 { 0.0f } );
+
+    /// <summary>
+    /// Get the fattened AABB of a proxy.
+    /// </summary>
+    const AABB2& getFatAABB( int32_t proxy ) const noexcept
+    {
+        return m_Nodes[proxy].aabb;
+    }
+
+    /// <summary>
+    /// Get the user data of a proxy.
+    /// </summary>
+    uint32_t getUserData( int32_t proxy ) const noexcept
+    {
+        return m_Nodes[proxy].userData;
+    }
+
+    /// <summary>
+    /// Get the number of proxies in the tree.
+    /// </summary>
+    size_t size() const noexcept
+    {
+        return m_ProxyCount;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_ProxyCount == 0u;
+    }
+
+    /// <summary>
+    /// Get the height of the tree (0 for a tree with a single proxy).
+    /// </summary>
+    int32_t getHeight() const noexcept
+    {
+        return m_Root != NullNode ? m_Nodes[m_Root].height : 0;
+    }
+
+    /// <summary>
+    /// Compute the cost of the tree: the sum of the perimeters of the internal nodes, relative to the perimeter of the root.
+    /// A lower cost means that queries need to visit fewer nodes.
+    /// </summary>
+    float getCost() const noexcept;
+
+    /// <summary>
+    /// Find the proxies whose fattened AABB intersects an AABB.
+    /// </summary>
+    /// <param name="aabb">The AABB to query.</param>
+    /// <param name="callback">Called with each proxy that is found. Return `false` to stop the query.</param>
+    template<typename Callback>
+    void query( const AABB2& aabb, Callback&& callback ) const;
+
+    /// <summary>
+    /// Find the proxies whose fattened AABB contains a point.
+    /// </summary>
+    /// <param name="point">The point to query.</param>
+    /// <param name="callback">Called with each proxy that is found. Return `false` to stop the query.</param>
+    template<typename Callback>
+    void query( const glm::vec2& point, Callback&& callback ) const;
+
+    /// <summary>
+    /// Find the proxies whose fattened AABB is hit by a ray.
+    /// The callback is called with the proxy and the distance to its fattened AABB. It should test the object itself and
+    /// return the new length of the ray: the distance to the object to find the closest object, `maxT` to find all the
+    /// objects, or 0 to stop the query.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The direction of the ray (does not need to be normalized).</param>
+    /// <param name="maxT">The length of the ray (in multiples of `direction`).</param>
+    /// <param name="callback">Called as `float callback( int32_t proxy, float t )` with each proxy that is hit.</param>
+    template<typename Callback>
+    void raycast( const glm::vec2& origin, const glm::vec2& direction, float maxT, Callback&& callback ) const;
+
+    /// <summary>
+    /// Find all pairs of proxies whose fattened AABBs overlap.
+    /// </summary>
+    /// <param name="pairs">The pairs are appended to this vector.</param>
+    void queryPairs( std::vector<Pair>& pairs ) const;
+
+    /// <summary>
+    /// Find the pairs of proxies whose fattened AABBs overlap, where at least one of the proxies was inserted or
+    /// reinserted since the previous call. Proxies that stay inside their fattened AABB don't create new pairs, so this
+    /// is much cheaper than queryPairs if most objects don't move far.
+    /// </summary>
+    /// <param name="pairs">The pairs are appended to this vector.</param>
+    void queryMovedPairs( std::vector<Pair>& pairs );
+
+private:
+    struct Node
+    {
+        AABB2 aabb;
+
+        union
+        {
+            int32_t parent = NullNode;
+            int32_t next;  // The next free node.
+        };
+
+        int32_t  child1   = NullNode;
+        int32_t  child2   = NullNode;
+        int32_t  height   = 0;  // 0 for a leaf, -1 for a free node.
+        uint32_t userData = 0u;
+        bool     moved    = false;
+
+        bool isLeaf() const noexcept
+        {
+            return child1 == NullNode;
+        }
+    };
+
+    // A stack of nodes to visit that only allocates if the tree is very deep.
+    class NodeStack
+    {
+    public:
+        void push( int32_t node )
+        {
+            if ( m_Size < InlineSize )
+                m_Nodes[m_Size] = node;
+            else
+                m_Overflow.push_back( node );
+
+            ++m_Size;
+        }
+
+        int32_t pop() noexcept
+        {
+            --m_Size;
+            if ( m_Size < InlineSize )
+                return m_Nodes[m_Size];
+
+            const int32_t node = m_Overflow.back();
+            m_Overflow.pop_back();
+            return node;
+        }
+
+        bool empty() const noexcept
+        {
+            return m_Size == 0u;
+        }
+
+    private:
+        static constexpr size_t InlineSize = 64;
+
+        int32_t              m_Nodes[InlineSize];
+        size_t               m_Size = 0u;
+        std::vector<int32_t> m_Overflow;
+    };
+
+    int32_t allocateNode();
+    void    freeNode( int32_t node ) noexcept;
+
+    void insertLeaf( int32_t leaf );
+    void removeLeaf( int32_t leaf ) noexcept;
+
+    // Refit the AABBs and heights (and rotate the nodes) from a node up to the root.
+    void refit( int32_t node ) noexcept;
+    void rotate( int32_t node ) noexcept;
+
+    int32_t buildRange( std::span<int32_t> leaves );
+
+    void markMoved( int32_t proxy );
+
+    float m_Margin;
+    float m_DisplacementMultiplier;
+
+    std::vector<Node> m_Nodes;
+    int32_t           m_Root       = NullNode;
+    int32_t           m_FreeList   = NullNode;
+    size_t            m_ProxyCount = 0u;
+
+    // The proxies that were inserted or reinserted since the last call to queryMovedPairs.
+    std::vector<int32_t> m_Moved;
+};
+
+template<typename Callback>
+void AABBTree::query( const AABB2& aabb, Callback&& callback ) const
+{
+    if ( m_Root == NullNode )
+        return;
+
+    NodeStack stack;
+    stack.push( m_Root );
+
+    while ( !stack.empty() )
+    {
+        const Node& node = m_Nodes[stack.pop()];
+        if ( !node.aabb.intersect( aabb ) )
+            continue;
+
+        if ( node.isLeaf() )
+        {
+            if ( !callback( static_cast<int32_t>( &node - m_Nodes.data() ) ) )
+                return;
+        }
+        else
+        {
+            stack.push( node.child1 );
+            stack.push( node.child2 );
+        }
+    }
+}
+
+template<typename Callback>
+void AABBTree::query( const glm::vec2& point, Callback&& callback ) const
+{
+    if ( m_Root == NullNode )
+        return;
+
+    NodeStack stack;
+    stack.push( m_Root );
+
+    while ( !stack.empty() )
+    {
+        const Node& node = m_Nodes[stack.pop()];
+        if ( !node.aabb.contains( point ) )
+            continue;
+
+        if ( node.isLeaf() )
+        {
+            if ( !callback( static_cast<int32_t>( &node - m_Nodes.data() ) ) )
+                return;
+        }
+        else
+        {
+            stack.push( node.child1 );
+            stack.push( node.child2 );
+        }
+    }
+}
+
+template<typename Callback>
+void AABBTree::raycast( const glm::vec2& origin, const glm::vec2& direction, float maxT, Callback&& callback ) const
+{
+    if ( m_Root == NullNode )
+        return;
+
+    NodeStack stack;
+    stack.push( m_Root );
+
+    while ( !stack.empty() )
+    {
+        const int32_t index = stack.pop();
+        const Node&   node  = m_Nodes[index];
+
+        const float t = node.aabb.raycast( origin, direction, maxT );
+        if ( t < 0.0f )
+            continue;
+
+        if ( node.isLeaf() )
+        {
+            // The callback clips the ray.
+            maxT = callback( index, t );
+            if ( maxT <= 0.0f )
+                return;
+        }
+        else
+        {
+            stack.push( node.child1 );
+            stack.push( node.child2 );
+        }
+    }
+}
+
+}  // namespace Math
@@ -0,0 +1,607 @@
+#include <Math/AABB2Array.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+
+#if defined( _M_X64 ) || defined( __x86_64__ )
+    #define MATH_X64
+    #include <immintrin.h>
+    #if defined( _MSC_VER )
+        #include <intrin.h>
+    #endif
+#endif
+
+// MSVC allows AVX2 intrinsics in any function, GCC and Clang only allow them in functions that are compiled for AVX2.
+// The AVX2 kernels are only called if the CPU supports AVX2, so the rest of the library doesn't require it.
+#if defined( __GNUC__ ) || defined( __clang__ )
+    #define MATH_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#else
+    #define MATH_TARGET_AVX2
+#endif
+
+using namespace Math;
+
+namespace
+{
+// The boxes that are tested by the kernels. The arrays are padded to a multiple of AABB2Array::Alignment.
+struct Boxes
+{
+    const float* minX;
+    const float* minY;
+    const float* maxX;
+    const float* maxY;
+    size_t       count;
+};
+
+// A ray (or line segment) that is prepared for the slab test.
+struct Ray
+{
+    glm::vec2 origin;
+    glm::vec2 invDir;
+    float     maxT;
+    bool      parallelX;  // The ray is parallel to the x-axis slabs (direction.x == 0).
+    bool      parallelY;
+    bool      negX;  // The ray enters the boxes through max.x.
+    bool      negY;
+};
+
+Ray makeRay( const glm::vec2& origin, const glm::vec2& direction, float maxT ) noexcept
+{
+    return {
+        .origin    = origin,
+        .invDir    = { direction.x != 0.0f ? 1.0f / direction.x : 0.0f, direction.y != 0.0f ? 1.0f / direction.y : 0.0f },
+        .maxT      = maxT,
+        .parallelX = direction.x == 0.0f,
+        .parallelY = direction.y == 0.0f,
+        .negX      = direction.x < 0.0f,
+        .negY      = direction.y < 0.0f,
+    };
+}
+
+// The kernels for one instruction set.
+struct Kernels
+{
+    // Write the indices of the boxes that intersect the box. Returns the number of indices.
+    size_t ( *overlapBox )( const Boxes& boxes, const AABB2& box, uint32_t* indices ) noexcept;
+
+    // Set bit i of the mask if box i intersects the box. The mask must be cleared.
+    void ( *overlapMask )( const Boxes& boxes, const AABB2& box, uint64_t* mask ) noexcept;
+
+    // Write the indices of the boxes that are hit by the ray. Returns the number of indices.
+    size_t ( *overlapRay )( const Boxes& boxes, const Ray& ray, uint32_t* indices ) noexcept;
+
+    // Find the closest box that is hit by the ray.
+    bool ( *raycast )( const Boxes& boxes, const Ray& ray, RayHit& hit ) noexcept;
+};
+
+// Append the indices of the set bits of a block mask.
+size_t writeIndices( uint32_t bits, uint32_t base, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    while ( bits )
+    {
+        indices[n++] = base + static_cast<uint32_t>( std::countr_zero( bits ) );
+        bits &= bits - 1u;
+    }
+    return n;
+}
+
+// The mask of the valid lanes of the block that starts at box i.
+uint32_t laneMask( size_t i, size_t count, size_t width ) noexcept
+{
+    const size_t lanes = std::min( count - i, width );
+    return ( 1u << lanes ) - 1u;
+}
+
+//
+// Scalar kernels.
+//
+
+// The entry distance of the ray into box i, or a negative value if the ray misses the box.
+float slabScalar( const Boxes& boxes, const Ray& ray, size_t i ) noexcept
+{
+    float tMin = 0.0f;
+    float tMax = ray.maxT;
+
+    if ( ray.parallelX )
+    {
+        if ( ray.origin.x < boxes.minX[i] || ray.origin.x > boxes.maxX[i] )
+            return -1.0f;
+    }
+    else
+    {
+        const float t0 = ( ( ray.negX ? boxes.maxX[i] : boxes.minX[i] ) - ray.origin.x ) * ray.invDir.x;
+        const float t1 = ( ( ray.negX ? boxes.minX[i] : boxes.maxX[i] ) - ray.origin.x ) * ray.invDir.x;
+        tMin           = std::max( tMin, t0 );
+        tMax           = std::min( tMax, t1 );
+    }
+
+    if ( ray.parallelY )
+    {
+        if ( ray.origin.y < boxes.minY[i] || ray.origin.y > boxes.maxY[i] )
+            return -1.0f;
+    }
+    else
+    {
+        const float t0 = ( ( ray.negY ? boxes.maxY[i] : boxes.minY[i] ) - ray.origin.y ) * ray.invDir.y;
+        const float t1 = ( ( ray.negY ? boxes.minY[i] : boxes.maxY[i] ) - ray.origin.y ) * ray.invDir.y;
+        tMin           = std::max( tMin, t0 );
+        tMax           = std::min( tMax, t1 );
+    }
+
+    return tMin <= tMax ? tMin : -1.0f;
+}
+
+bool overlapScalar( const Boxes& boxes, const AABB2& box, size_t i ) noexcept
+{
+    return boxes.minX[i] <= box.max.x && boxes.minY[i] <= box.max.y && boxes.maxX[i] >= box.min.x && boxes.maxY[i] >= box.min.y;
+}
+
+size_t overlapBoxScalar( const Boxes& boxes, const AABB2& box, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; ++i )
+    {
+        if ( overlapScalar( boxes, box, i ) )
+            indices[n++] = static_cast<uint32_t>( i );
+    }
+    return n;
+}
+
+void overlapMaskScalar( const Boxes& boxes, const AABB2& box, uint64_t* mask ) noexcept
+{
+    for ( size_t i = 0; i < boxes.count; ++i )
+    {
+        if ( overlapScalar( boxes, box, i ) )
+            mask[i / 64] |= uint64_t { 1 } << ( i % 64 );
+    }
+}
+
+size_t overlapRayScalar( const Boxes& boxes, const Ray& ray, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; ++i )
+    {
+        if ( slabScalar( boxes, ray, i ) >= 0.0f )
+            indices[n++] = static_cast<uint32_t>( i );
+    }
+    return n;
+}
+
+bool raycastScalar( const Boxes& boxes, const Ray& ray, RayHit& hit ) noexcept
+{
+    bool found = false;
+    for ( size_t i = 0; i < boxes.count; ++i )
+    {
+        const float t = slabScalar( boxes, ray, i );
+        if ( t >= 0.0f && ( !found || t < hit.t ) )
+        {
+            hit   = { static_cast<uint32_t>( i ), t };
+            found = true;
+        }
+    }
+    return found;
+}
+
+constexpr Kernels ScalarKernels { overlapBoxScalar, overlapMaskScalar, overlapRayScalar, raycastScalar };
+
+#if defined( MATH_X64 )
+
+//
+// SSE kernels (4 boxes at a time).
+//
+
+__m128 overlapSSE( const Boxes& boxes, const AABB2& box, size_t i ) noexcept
+{
+    const __m128 minX = _mm_loadu_ps( boxes.minX + i );
+    const __m128 minY = _mm_loadu_ps( boxes.minY + i );
+    const __m128 maxX = _mm_loadu_ps( boxes.maxX + i );
+    const __m128 maxY = _mm_loadu_ps( boxes.maxY + i );
+
+    const __m128 x = _mm_and_ps( _mm_cmple_ps( minX, _mm_set1_ps( box.max.x ) ), _mm_cmpge_ps( maxX, _mm_set1_ps( box.min.x ) ) );
+    const __m128 y = _mm_and_ps( _mm_cmple_ps( minY, _mm_set1_ps( box.max.y ) ), _mm_cmpge_ps( maxY, _mm_set1_ps( box.min.y ) ) );
+
+    return _mm_and_ps( x, y );
+}
+
+// The entry distances of the ray into boxes [i, i + 4). `hit` is set for the boxes that are hit by the ray.
+__m128 slabSSE( const Boxes& boxes, const Ray& ray, size_t i, __m128& hit ) noexcept
+{
+    __m128 tMin = _mm_setzero_ps();
+    __m128 tMax = _mm_set1_ps( ray.maxT );
+    hit         = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+
+    const __m128 minX = _mm_loadu_ps( boxes.minX + i );
+    const __m128 maxX = _mm_loadu_ps( boxes.maxX + i );
+    const __m128 ox   = _mm_set1_ps( ray.origin.x );
+    if ( ray.parallelX )
+    {
+        hit = _mm_and_ps( hit, _mm_and_ps( _mm_cmple_ps( minX, ox ), _mm_cmpge_ps( maxX, ox ) ) );
+    }
+    else
+    {
+        const __m128 inv = _mm_set1_ps( ray.invDir.x );
+        tMin             = _mm_max_ps( tMin, _mm_mul_ps( _mm_sub_ps( ray.negX ? maxX : minX, ox ), inv ) );
+        tMax             = _mm_min_ps( tMax, _mm_mul_ps( _mm_sub_ps( ray.negX ? minX : maxX, ox ), inv ) );
+    }
+
+    const __m128 minY = _mm_loadu_ps( boxes.minY + i );
+    const __m128 maxY = _mm_loadu_ps( boxes.maxY + i );
+    const __m128 oy   = _mm_set1_ps( ray.origin.y );
+    if ( ray.parallelY )
+    {
+        hit = _mm_and_ps( hit, _mm_and_ps( _mm_cmple_ps( minY, oy ), _mm_cmpge_ps( maxY, oy ) ) );
+    }
+    else
+    {
+        const __m128 inv = _mm_set1_ps( ray.invDir.y );
+        tMin             = _mm_max_ps( tMin, _mm_mul_ps( _mm_sub_ps( ray.negY ? maxY : minY, oy ), inv ) );
+        tMax             = _mm_min_ps( tMax, _mm_mul_ps( _mm_sub_ps( ray.negY ? minY : maxY, oy ), inv ) );
+    }
+
+    hit = _mm_and_ps( hit, _mm_cmple_ps( tMin, tMax ) );
+
+    return tMin;
+}
+
+size_t overlapBoxSSE( const Boxes& boxes, const AABB2& box, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; i += 4 )
+    {
+        const uint32_t bits = static_cast<uint32_t>( _mm_movemask_ps( overlapSSE( boxes, box, i ) ) ) & laneMask( i, boxes.count, 4 );
+        n += writeIndices( bits, static_cast<uint32_t>( i ), indices + n );
+    }
+    return n;
+}
+
+void overlapMaskSSE( const Boxes& boxes, const AABB2& box, uint64_t* mask ) noexcept
+{
+    for ( size_t i = 0; i < boxes.count; i += 4 )
+    {
+        const uint32_t bits = static_cast<uint32_t>( _mm_movemask_ps( overlapSSE( boxes, box, i ) ) ) & laneMask( i, boxes.count, 4 );
+        mask[i / 64] |= static_cast<uint64_t>( bits ) << ( i % 64 );
+    }
+}
+
+size_t overlapRaySSE( const Boxes& boxes, const Ray& ray, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; i += 4 )
+    {
+        __m128 hit;
+        slabSSE( boxes, ray, i, hit );
+
+        const uint32_t bits = static_cast<uint32_t>( _mm_movemask_ps( hit ) ) & laneMask( i, boxes.count, 4 );
+        n += writeIndices( bits, static_cast<uint32_t>( i ), indices + n );
+    }
+    return n;
+}
+
+bool raycastSSE( const Boxes& boxes, const Ray& ray, RayHit& hit ) noexcept
+{
+    bool found = false;
+    for ( size_t i = 0; i < boxes.count; i += 4 )
+    {
+        __m128       mask;
+        const __m128 t = slabSSE( boxes, ray, i, mask );
+
+        uint32_t bits = static_cast<uint32_t>( _mm_movemask_ps( mask ) ) & laneMask( i, boxes.count, 4 );
+        if ( !bits )
+            continue;
+
+        alignas( 16 ) float ts[4];
+        _mm_store_ps( ts, t );
+
+        while ( bits )
+        {
+            const uint32_t lane = static_cast<uint32_t>( std::countr_zero( bits ) );
+            if ( !found || ts[lane] < hit.t )
+            {
+                hit   = { static_cast<uint32_t>( i ) + lane, ts[lane] };
+                found = true;
+            }
+            bits &= bits - 1u;
+        }
+    }
+    return found;
+}
+
+constexpr Kernels SSEKernels { overlapBoxSSE, overlapMaskSSE, overlapRaySSE, raycastSSE };
+
+//
+// AVX2 kernels (8 boxes at a time).
+//
+
+MATH_TARGET_AVX2 __m256 overlapAVX2( const Boxes& boxes, const AABB2& box, size_t i ) noexcept
+{
+    const __m256 minX = _mm256_loadu_ps( boxes.minX + i );
+    const __m256 minY = _mm256_loadu_ps( boxes.minY + i );
+    const __m256 maxX = _mm256_loadu_ps( boxes.maxX + i );
+    const __m256 maxY = _mm256_loadu_ps( boxes.maxY + i );
+
+    const __m256 x = _mm256_and_ps( _mm256_cmp_ps( minX, _mm256_set1_ps( box.max.x ), _CMP_LE_OQ ), _mm256_cmp_ps( maxX, _mm256_set1_ps( box.min.x ), _CMP_GE_OQ ) );
+    const __m256 y = _mm256_and_ps( _mm256_cmp_ps( minY, _mm256_set1_ps( box.max.y ), _CMP_LE_OQ ), _mm256_cmp_ps( maxY, _mm256_set1_ps( box.min.y ), _CMP_GE_OQ ) );
+
+    return _mm256_and_ps( x, y );
+}
+
+MATH_TARGET_AVX2 __m256 slabAVX2( const Boxes& boxes, const Ray& ray, size_t i, __m256& hit ) noexcept
+{
+    __m256 tMin = _mm256_setzero_ps();
+    __m256 tMax = _mm256_set1_ps( ray.maxT );
+    hit         = _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) );
+
+    const __m256 minX = _mm256_loadu_ps( boxes.minX + i );
+    const __m256 maxX = _mm256_loadu_ps( boxes.maxX + i );
+    const __m256 ox   = _mm256_set1_ps( ray.origin.x );
+    if ( ray.parallelX )
+    {
+        hit = _mm256_and_ps( hit, _mm256_and_ps( _mm256_cmp_ps( minX, ox, _CMP_LE_OQ ), _mm256_cmp_ps( maxX, ox, _CMP_GE_OQ ) ) );
+    }
+    else
+    {
+        const __m256 inv = _mm256_set1_ps( ray.invDir.x );
+        tMin             = _mm256_max_ps( tMin, _mm256_mul_ps( _mm256_sub_ps( ray.negX ? maxX : minX, ox ), inv ) );
+        tMax             = _mm256_min_ps( tMax, _mm256_mul_ps( _mm256_sub_ps( ray.negX ? minX : maxX, ox ), inv ) );
+    }
+
+    const __m256 minY = _mm256_loadu_ps( boxes.minY + i );
+    const __m256 maxY = _mm256_loadu_ps( boxes.maxY + i );
+    const __m256 oy   = _mm256_set1_ps( ray.origin.y );
+    if ( ray.parallelY )
+    {
+        hit = _mm256_and_ps( hit, _mm256_and_ps( _mm256_cmp_ps( minY, oy, _CMP_LE_OQ ), _mm256_cmp_ps( maxY, oy, _CMP_GE_OQ ) ) );
+    }
+    else
+    {
+        const __m256 inv = _mm256_set1_ps( ray.invDir.y );
+        tMin             = _mm256_max_ps( tMin, _mm256_mul_ps( _mm256_sub_ps( ray.negY ? maxY : minY, oy ), inv ) );
+        tMax             = _mm256_min_ps( tMax, _mm256_mul_ps( _mm256_sub_ps( ray.negY ? minY : maxY, oy ), inv ) );
+    }
+
+    hit = _mm256_and_ps( hit, _mm256_cmp_ps( tMin, tMax, _CMP_LE_OQ ) );
+
+    return tMin;
+}
+
+MATH_TARGET_AVX2 size_t overlapBoxAVX2( const Boxes& boxes, const AABB2& box, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; i += 8 )
+    {
+        const uint32_t bits = static_cast<uint32_t>( _mm256_movemask_ps( overlapAVX2( boxes, box, i ) ) ) & laneMask( i, boxes.count, 8 );
+        n += writeIndices( bits, static_cast<uint32_t>( i ), indices + n );
+    }
+    return n;
+}
+
+MATH_TARGET_AVX2 void overlapMaskAVX2( const Boxes& boxes, const AABB2& box, uint64_t* mask ) noexcept
+{
+    for ( size_t i = 0; i < boxes.count; i += 8 )
+    {
+        const uint32_t bits = static_cast<uint32_t>( _mm256_movemask_ps( overlapAVX2( boxes, box, i ) ) ) & laneMask( i, boxes.count, 8 );
+        mask[i / 64] |= static_cast<uint64_t>( bits ) << ( i % 64 );
+    }
+}
+
+MATH_TARGET_AVX2 size_t overlapRayAVX2( const Boxes& boxes, const Ray& ray, uint32_t* indices ) noexcept
+{
+    size_t n = 0u;
+    for ( size_t i = 0; i < boxes.count; i += 8 )
+    {
+        __m256 hit;
+        slabAVX2( boxes, ray, i, hit );
+
+        const uint32_t bits = static_cast<uint32_t>( _mm256_movemask_ps( hit ) ) & laneMask( i, boxes.count, 8 );
+        n += writeIndices( bits, static_cast<uint32_t>( i ), indices + n );
+    }
+    return n;
+}
+
+MATH_TARGET_AVX2 bool raycastAVX2( const Boxes& boxes, const Ray& ray, RayHit& hit ) noexcept
+{
+    bool found = false;
+    for ( size_t i = 0; i < boxes.count; i += 8 )
+    {
+        __m256       mask;
+        const __m256 t = slabAVX2( boxes, ray, i, mask );
+
+        uint32_t bits = static_cast<uint32_t>( _mm256_movemask_ps( mask ) ) & laneMask( i, boxes.count, 8 );
+        if ( !bits )
+            continue;
+
+        alignas( 32 ) float ts[8];
+        _mm256_store_ps( ts, t );
+
+        while ( bits )
+        {
+            const uint32_t lane = static_cast<uint32_t>( std::countr_zero( bits ) );
+            if ( !found || ts[lane] < hit.t )
+            {
+                hit   = { static_cast<uint32_t>( i ) + lane, ts[lane] };
+                found = true;
+            }
+            bits &= bits - 1u;
+        }
+    }
+    return found;
+}
+
+constexpr Kernels AVX2Kernels { overlapBoxAVX2, overlapMaskAVX2, overlapRayAVX2, raycastAVX2 };
+
+#endif
+
+SimdLevel detectSimdLevel() noexcept
+{
+#if defined( MATH_X64 )
+    #if defined( _MSC_VER ) && !defined( __clang__ )
+    int info[4];
+    __cpuid( info, 0 );
+    const int maxLeaf = info[0];
+
+    __cpuid( info, 1 );
+    const bool osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+    const bool avx     = ( info[2] & ( 1 << 28 ) ) != 0;
+
+    // AVX2 also requires the OS to save the YMM registers on a context switch.
+    if ( maxLeaf >= 7 && osxsave && avx && ( _xgetbv( 0 ) & 0x6 ) == 0x6 )
+    {
+        __cpuidex( info, 7, 0 );
+        if ( info[1] & ( 1 << 5 ) )
+            return SimdLevel::AVX2;
+    }
+    #else
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx2" ) )
+        return SimdLevel::AVX2;
+    #endif
+
+    // SSE2 is always available on x64.
+    return SimdLevel::SSE;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const SimdLevel g_SupportedSimdLevel = detectSimdLevel();
+
+std::atomic<SimdLevel> g_SimdLevel { g_SupportedSimdLevel };
+
+const Kernels& getKernels() noexcept
+{
+    switch ( g_SimdLevel.load( std::memory_order_relaxed ) )
+    {
+#if defined( MATH_X64 )
+    case SimdLevel::AVX2:
+        return AVX2Kernels;
+    case SimdLevel::SSE:
+        return SSEKernels;
+#endif
+    default:
+        return ScalarKernels;
+    }
+}
+
+size_t alignSize( size_t size ) noexcept
+{
+    return ( size + AABB2Array::Alignment - 1 ) / AABB2Array::Alignment * AABB2Array::Alignment;
+}
+}  // namespace
+
+SimdLevel Math::getSimdLevel() noexcept
+{
+    return g_SimdLevel.load( std::memory_order_relaxed );
+}
+
+SimdLevel Math::getSupportedSimdLevel() noexcept
+{
+    return g_SupportedSimdLevel;
+}
+
+SimdLevel Math::setSimdLevel( SimdLevel level ) noexcept
+{
+    level = std::min( level, g_SupportedSimdLevel );
+    g_SimdLevel.store( level, std::memory_order_relaxed );
+
+    return level;
+}
+
+AABB2Array::AABB2Array( std::span<const AABB2> boxes )
+{
+    resize( boxes.size() );
+
+    for ( size_t i = 0; i < boxes.size(); ++i )
+        set( i, boxes[i] );
+}
+
+void AABB2Array::reserve( size_t size )
+{
+    size = alignSize( size );
+
+    m_MinX.reserve( size );
+    m_MinY.reserve( size );
+    m_MaxX.reserve( size );
+    m_MaxY.reserve( size );
+}
+
+void AABB2Array::resize( size_t size )
+{
+    const size_t padded = alignSize( size );
+
+    // New boxes are empty (they don't intersect anything).
+    m_MinX.resize( padded, std::numeric_limits<float>::max() );
+    m_MinY.resize( padded, std::numeric_limits<float>::max() );
+    m_MaxX.resize( padded, std::numeric_limits<float>::lowest() );
+    m_MaxY.resize( padded, std::numeric_limits<float>::lowest() );
+
+    m_Count = size;
+}
+
+void AABB2Array::clear() noexcept
+{
+    m_MinX.clear();
+    m_MinY.clear();
+    m_MaxX.clear();
+    m_MaxY.clear();
+
+    m_Count = 0u;
+}
+
+void AABB2Array::push_back( const AABB2& box )
+{
+    if ( m_Count == m_MinX.size() )
+        resize( m_Count + 1 );
+    else
+        ++m_Count;
+
+    set( m_Count - 1, box );
+}
+
+size_t AABB2Array::overlap( const AABB2& box, std::vector<uint32_t>& indices ) const
+{
+    // Make room for the worst case, then shrink to the number of boxes that were found.
+    const size_t first = indices.size();
+    indices.resize( first + m_Count );
+
+    const size_t n = getKernels().overlapBox( { minX(), minY(), maxX(), maxY(), m_Count }, box, indices.data() + first );
+    indices.resize( first + n );
+
+    return n;
+}
+
+size_t AABB2Array::overlap( const glm::vec2& p0, const glm::vec2& p1, std::vector<uint32_t>& indices ) const
+{
+    const size_t first = indices.size();
+    indices.resize( first + m_Count );
+
+    const size_t n = getKernels().overlapRay( { minX(), minY(), maxX(), maxY(), m_Count }, makeRay( p0, p1 - p0, 1.0f ), indices.data() + first );
+    indices.resize( first + n );
+
+    return n;
+}
+
+void AABB2Array::overlap( const AABB2Array& other, std::span<uint64_t> masks ) const noexcept
+{
+    const size_t words = getMaskWords( other.size() );
+    assert( masks.size() >= m_Count * words );
+
+    std::fill_n( masks.begin(), m_Count * words, uint64_t { 0 } );
+
+    const Kernels& kernels = getKernels();
+    const Boxes    boxes { other.minX(), other.minY(), other.maxX(), other.maxY(), other.size() };
+
+    for ( size_t i = 0; i < m_Count; ++i )
+        kernels.overlapMask( boxes, ( *this )[i], masks.data() + i * words );
+}
+
+std::optional<RayHit> AABB2Array::raycast( const glm::vec2& origin, const glm::vec2& direction, float maxT ) const noexcept
+{
+    RayHit hit {};
+    if ( getKernels().raycast( { minX(), minY(), maxX(), maxY(), m_Count }, makeRay( origin, direction, maxT ), hit ) )
+        return hit;
+
+    return {};
+}
@@ -0,0 +1,544 @@
+#include <Math/AABBTree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <utility>
+
+using namespace Math;
+
+AABBTree::AABBTree( float margin, float displacementMultiplier ) noexcept
+: m_Margin { margin }
+, m_DisplacementMultiplier { displacementMultiplier }
+{}
+
+void AABBTree::clear() noexcept
+{
+    m_Nodes.clear();
+    m_Moved.clear();
+
+    m_Root       = NullNode;
+    m_FreeList   = NullNode;
+    m_ProxyCount = 0u;
+}
+
+void AABBTree::build( std::span<const AABB2> aabbs )
+{
+    clear();
+
+    if ( aabbs.empty() )
+        return;
+
+    // A binary tree with n leaves has n - 1 internal nodes. The leaves are stored first, so the proxy of aabbs[i] is i.
+    m_Nodes.reserve( aabbs.size() * 2 - 1 );
+    m_Nodes.resize( aabbs.size() );
+
+    std::vector<int32_t> leaves( aabbs.size() );
+    for ( size_t i = 0; i < aabbs.size(); ++i )
+    {
+        m_Nodes[i].aabb     = aabbs[i];
+        m_Nodes[i].userData = static_cast<uint32_t>( i );
+        leaves[i]           = static_cast<int32_t>( i );
+    }
+
+    m_ProxyCount = aabbs.size();
+
+    m_Root                 = buildRange( leaves );
+    m_Nodes[m_Root].parent = NullNode;
+}
+
+int32_t AABBTree::buildRange( std::span<int32_t> leaves )
+{
+    if ( leaves.size() == 1 )
+        return leaves[0];
+
+    // Split the leaves along the axis where their centers are the most spread out.
+    AABB2 centers;
+    for ( int32_t leaf: leaves )
+        centers.expand( m_Nodes[leaf].aabb.center() );
+
+    const int   axis   = centers.width() >= centers.height() ? 0 : 1;
+    const float extent = centers.max[axis] - centers.min[axis];
+
+    auto split = leaves.begin() + static_cast<ptrdiff_t>( leaves.size() / 2 );
+
+    if ( extent > 0.0f )
+    {
+        // Binned SAH: sort the centers into bins and split between the bins where the cost (the perimeter of each side
+        // times the number of leaves on that side) is the lowest.
+        constexpr int NumBins = 16;
+
+        struct Bin
+        {
+            AABB2  aabb;
+            size_t count = 0u;
+        };
+
+        std::array<Bin, NumBins> bins {};
+
+        const auto getBin = [&]( int32_t leaf ) {
+            const float offset = m_Nodes[leaf].aabb.center()[axis] - centers.min[axis];
+            return std::min( static_cast<int>( offset / extent * NumBins ), NumBins - 1 );
+        };
+
+        for ( int32_t leaf: leaves )
+        {
+            Bin& bin = bins[getBin( leaf )];
+            bin.aabb.expand( m_Nodes[leaf].aabb );
+            ++bin.count;
+        }
+
+        // The cost of the right side of each split.
+        std::array<float, NumBins> rightCost {};
+        AABB2                      right;
+        size_t                     rightCount = 0u;
+        for ( int i = NumBins - 1; i > 0; --i )
+        {
+            right.expand( bins[i].aabb );
+            rightCount += bins[i].count;
+            rightCost[i] = rightCount > 0u ? right.perimeter() * static_cast<float>( rightCount ) : 0.0f;
+        }
+
+        // Split between bin i - 1 and bin i. The first and the last bins are never empty, so there is always a split.
+        AABB2  left;
+        size_t leftCount = 0u;
+        int    bestSplit = 1;
+        float  bestCost  = std::numeric_limits<float>::max();
+        for ( int i = 1; i < NumBins; ++i )
+        {
+            left.expand( bins[i - 1].aabb );
+            leftCount += bins[i - 1].count;
+
+            if ( leftCount == 0u || leftCount == leaves.size() )
+                continue;
+
+            const float cost = left.perimeter() * static_cast<float>( leftCount ) + rightCost[i];
+            if ( cost < bestCost )
+            {
+                bestCost  = cost;
+                bestSplit = i;
+            }
+        }
+
+        split = std::partition( leaves.begin(), leaves.end(), [&]( int32_t leaf ) { return getBin( leaf ) < bestSplit; } );
+    }
+
+    // Internal nodes are appended after the leaves (the capacity was reserved, so the references don't move).
+    const int32_t child1 = buildRange( { leaves.begin(), split } );
+    const int32_t child2 = buildRange( { split, leaves.end() } );
+    const int32_t index  = allocateNode();
+
+    Node& node  = m_Nodes[index];
+    node.aabb   = AABB2::fromUnion( m_Nodes[child1].aabb, m_Nodes[child2].aabb );
+    node.child1 = child1;
+    node.child2 = child2;
+    node.height = 1 + std::max( m_Nodes[child1].height, m_Nodes[child2].height );
+
+    m_Nodes[child1].parent = index;
+    m_Nodes[child2].parent = index;
+
+    return index;
+}
+
+int32_t AABBTree::insert( const AABB2& aabb, uint32_t userData )
+{
+    const int32_t proxy = allocateNode();
+
+    Node& node    = m_Nodes[proxy];
+    node.aabb     = aabb.inflated( m_Margin );
+    node.userData = userData;
+
+    insertLeaf( proxy );
+    markMoved( proxy );
+
+    ++m_ProxyCount;
+
+    return proxy;
+}
+
+void AABBTree::remove( int32_t proxy )
+{
+    assert( m_Nodes[proxy].isLeaf() );
+
+    if ( m_Nodes[proxy].moved )
+        std::erase( m_Moved, proxy );
+
+    removeLeaf( proxy );
+    freeNode( proxy );
+
+    --m_ProxyCount;
+}
+
+bool AABBTree::move( int32_t proxy, const AABB2& aabb, const glm::vec2& displacement )
+{
+    assert( m_Nodes[proxy].isLeaf() );
+
+    // Extend the fattened AABB in the direction the object is moving.
+    AABB2           fatAABB = aabb.inflated( m_Margin );
+    const glm::vec2 d       = displacement * m_DisplacementMultiplier;
+    fatAABB.min += glm::min( d, glm::vec2 { 0.0f } );
+    fatAABB.max += glm::max( d, glm::vec2 { 0.0f } );
+
+    const AABB2& treeAABB = m_Nodes[proxy].aabb;
+    if ( treeAABB.contains( aabb ) )
+    {
+        // Keep the current AABB unless it is much larger than it needs to be (the object slowed down).
+        if ( fatAABB.inflated( 4.0f * m_Margin ).contains( treeAABB ) )
+            return false;
+    }
+
+    removeLeaf( proxy );
+    m_Nodes[proxy].aabb = fatAABB;
+    insertLeaf( proxy );
+    markMoved( proxy );
+
+    return true;
+}
+
+float AABBTree::getCost() const noexcept
+{
+    if ( m_Root == NullNode || m_Nodes[m_Root].isLeaf() )
+        return 0.0f;
+
+    float perimeter = 0.0f;
+    for ( const Node& node: m_Nodes )
+    {
+        if ( node.height > 0 )
+            perimeter += node.aabb.perimeter();
+    }
+
+    return perimeter / m_Nodes[m_Root].aabb.perimeter();
+}
+
+void AABBTree::queryPairs( std::vector<Pair>& pairs ) const
+{
+    if ( m_Root == NullNode || m_Nodes[m_Root].isLeaf() )
+        return;
+
+    // Each entry is either a subtree to test against itself (a == b) or two subtrees to test against each other.
+    std::vector<std::pair<int32_t, int32_t>> stack;
+    stack.emplace_back( m_Root, m_Root );
+
+    while ( !stack.empty() )
+    {
+        const auto [a, b] = stack.back();
+        stack.pop_back();
+
+        const Node& nodeA = m_Nodes[a];
+        const Node& nodeB = m_Nodes[b];
+
+        if ( a == b )
+        {
+            // Only internal nodes are pushed to be tested against themselves.
+            stack.emplace_back( nodeA.child1, nodeA.child2 );
+
+            if ( !m_Nodes[nodeA.child1].isLeaf() )
+                stack.emplace_back( nodeA.child1, nodeA.child1 );
+            if ( !m_Nodes[nodeA.child2].isLeaf() )
+                stack.emplace_back( nodeA.child2, nodeA.child2 );
+
+            continue;
+        }
+
+        if ( !nodeA.aabb.intersect( nodeB.aabb ) )
+            continue;
+
+        if ( nodeA.isLeaf() && nodeB.isLeaf() )
+        {
+            pairs.push_back( { std::min( a, b ), std::max( a, b ) } );
+        }
+        else if ( nodeB.isLeaf() || ( !nodeA.isLeaf() && nodeA.aabb.perimeter() >= nodeB.aabb.perimeter() ) )
+        {
+            // Descend into the larger subtree.
+            stack.emplace_back( nodeA.child1, b );
+            stack.emplace_back( nodeA.child2, b );
+        }
+        else
+        {
+            stack.emplace_back( a, nodeB.child1 );
+            stack.emplace_back( a, nodeB.child2 );
+        }
+    }
+}
+
+void AABBTree::queryMovedPairs( std::vector<Pair>& pairs )
+{
+    for ( int32_t proxy: m_Moved )
+    {
+        query( m_Nodes[proxy].aabb, [&]( int32_t other ) {
+            // If both proxies moved, the pair is only reported by the query of the lower proxy.
+            if ( other == proxy || ( m_Nodes[other].moved && other < proxy ) )
+                return true;
+
+            pairs.push_back( { std::min( proxy, other ), std::max( proxy, other ) } );
+            return true;
+        } );
+    }
+
+    for ( int32_t proxy: m_Moved )
+        m_Nodes[proxy].moved = false;
+
+    m_Moved.clear();
+}
+
+int32_t AABBTree::allocateNode()
+{
+    if ( m_FreeList == NullNode )
+    {
+        m_Nodes.emplace_back();
+        return static_cast<int32_t>( m_Nodes.size() - 1 );
+    }
+
+    const int32_t index = m_FreeList;
+    m_FreeList          = m_Nodes[index].next;
+    m_Nodes[index]      = Node {};
+
+    return index;
+}
+
+void AABBTree::freeNode( int32_t node ) noexcept
+{
+    m_Nodes[node].next   = m_FreeList;
+    m_Nodes[node].height = -1;
+    m_FreeList           = node;
+}
+
+void AABBTree::insertLeaf( int32_t leaf )
+{
+    if ( m_Root == NullNode )
+    {
+        m_Root               = leaf;
+        m_Nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    // Find the best sibling for the leaf: descend into the child where the leaf increases the perimeter of the tree the
+    // least, until it is cheaper to make the current node the sibling.
+    const AABB2 leafAABB = m_Nodes[leaf].aabb;
+
+    int32_t index = m_Root;
+    while ( !m_Nodes[index].isLeaf() )
+    {
+        const Node& node = m_Nodes[index];
+
+        const float perimeter         = node.aabb.perimeter();
+        const float combinedPerimeter = AABB2::fromUnion( node.aabb, leafAABB ).perimeter();
+
+        // The cost of creating a new parent for this node and the leaf.
+        const float cost = 2.0f * combinedPerimeter;
+
+        // The cost of pushing the leaf further down the tree.
+        const float inheritanceCost = 2.0f * ( combinedPerimeter - perimeter );
+
+        const auto getChildCost = [&]( int32_t child ) {
+            const Node& childNode = m_Nodes[child];
+            const float childCost = AABB2::fromUnion( childNode.aabb, leafAABB ).perimeter() + inheritanceCost;
+
+            return childNode.isLeaf() ? childCost : childCost - childNode.aabb.perimeter();
+        };
+
+        const float cost1 = getChildCost( node.child1 );
+        const float cost2 = getChildCost( node.child2 );
+
+        if ( cost < cost1 && cost < cost2 )
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int32_t sibling   = index;
+    const int32_t oldParent = m_Nodes[sibling].parent;
+    const int32_t newParent = allocateNode();
+
+    Node& parent  = m_Nodes[newParent];
+    parent.parent = oldParent;
+    parent.aabb   = AABB2::fromUnion( leafAABB, m_Nodes[sibling].aabb );
+    parent.child1 = sibling;
+    parent.child2 = leaf;
+    parent.height = m_Nodes[sibling].height + 1;
+
+    if ( oldParent != NullNode )
+    {
+        Node& node = m_Nodes[oldParent];
+        if ( node.child1 == sibling )
+            node.child1 = newParent;
+        else
+            node.child2 = newParent;
+    }
+    else
+    {
+        m_Root = newParent;
+    }
+
+    m_Nodes[sibling].parent = newParent;
+    m_Nodes[leaf].parent    = newParent;
+
+    refit( oldParent );
+}
+
+void AABBTree::removeLeaf( int32_t leaf ) noexcept
+{
+    if ( leaf == m_Root )
+    {
+        m_Root = NullNode;
+        return;
+    }
+
+    const int32_t parent      = m_Nodes[leaf].parent;
+    const int32_t grandParent = m_Nodes[parent].parent;
+    const int32_t sibling     = m_Nodes[parent].child1 == leaf ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+    // Replace the parent with the sibling.
+    if ( grandParent != NullNode )
+    {
+        Node& node = m_Nodes[grandParent];
+        if ( node.child1 == parent )
+            node.child1 = sibling;
+        else
+            node.child2 = sibling;
+    }
+    else
+    {
+        m_Root = sibling;
+    }
+
+    m_Nodes[sibling].parent = grandParent;
+    freeNode( parent );
+
+    refit( grandParent );
+}
+
+void AABBTree::refit( int32_t index ) noexcept
+{
+    while ( index != NullNode )
+    {
+        Node&       node   = m_Nodes[index];
+        const Node& child1 = m_Nodes[node.child1];
+        const Node& child2 = m_Nodes[node.child2];
+
+        node.aabb   = AABB2::fromUnion( child1.aabb, child2.aabb );
+        node.height = 1 + std::max( child1.height, child2.height );
+
+        rotate( index );
+
+        index = node.parent;
+    }
+}
+
+void AABBTree::rotate( int32_t index ) noexcept
+{
+    // A has the children B and C, B has the children D and E, and C has the children F and G.
+    // Swapping B with F (or G) changes the AABB of C, swapping C with D (or E) changes the AABB of B. The AABB of A
+    // doesn't change, so pick the swap that reduces the perimeter of the changed node the most.
+    Node& a = m_Nodes[index];
+    if ( a.height < 2 )
+        return;
+
+    const int32_t b = a.child1;
+    const int32_t c = a.child2;
+
+    enum class Rotation
+    {
+        None,
+        BF,
+        BG,
+        CD,
+        CE,
+    };
+
+    Rotation best     = Rotation::None;
+    float    bestCost = 0.0f;
+
+    if ( !m_Nodes[c].isLeaf() )
+    {
+        const Node& nodeC = m_Nodes[c];
+        const float area  = nodeC.aabb.perimeter();
+
+        const float costBF = AABB2::fromUnion( m_Nodes[b].aabb, m_Nodes[nodeC.child2].aabb ).perimeter() - area;
+        const float costBG = AABB2::fromUnion( m_Nodes[b].aabb, m_Nodes[nodeC.child1].aabb ).perimeter() - area;
+
+        if ( costBF < bestCost )
+        {
+            best     = Rotation::BF;
+            bestCost = costBF;
+        }
+        if ( costBG < bestCost )
+        {
+            best     = Rotation::BG;
+            bestCost = costBG;
+        }
+    }
+
+    if ( !m_Nodes[b].isLeaf() )
+    {
+        const Node& nodeB = m_Nodes[b];
+        const float area  = nodeB.aabb.perimeter();
+
+        const float costCD = AABB2::fromUnion( m_Nodes[c].aabb, m_Nodes[nodeB.child2].aabb ).perimeter() - area;
+        const float costCE = AABB2::fromUnion( m_Nodes[c].aabb, m_Nodes[nodeB.child1].aabb ).perimeter() - area;
+
+        if ( costCD < bestCost )
+        {
+            best     = Rotation::CD;
+            bestCost = costCD;
+        }
+        if ( costCE < bestCost )
+        {
+            best     = Rotation::CE;
+            bestCost = costCE;
+        }
+    }
+
+    // Swap a child of A (x) with a grandchild (y) under A's other child (parent).
+    const auto swap = [&]( int32_t x, int32_t parent, bool firstChild ) {
+        Node&         p = m_Nodes[parent];
+        const int32_t y = firstChild ? p.child1 : p.child2;
+
+        if ( a.child1 == x )
+            a.child1 = y;
+        else
+            a.child2 = y;
+
+        if ( firstChild )
+            p.child1 = x;
+        else
+            p.child2 = x;
+
+        m_Nodes[x].parent = parent;
+        m_Nodes[y].parent = index;
+
+        const Node& child1 = m_Nodes[p.child1];
+        const Node& child2 = m_Nodes[p.child2];
+
+        p.aabb   = AABB2::fromUnion( child1.aabb, child2.aabb );
+        p.height = 1 + std::max( child1.height, child2.height );
+        a.height = 1 + std::max( m_Nodes[a.child1].height, m_Nodes[a.child2].height );
+    };
+
+    switch ( best )
+    {
+    case Rotation::None:
+        break;
+    case Rotation::BF:
+        swap( b, c, true );
+        break;
+    case Rotation::BG:
+        swap( b, c, false );
+        break;
+    case Rotation::CD:
+        swap( c, b, true );
+        break;
+    case Rotation::CE:
+        swap( c, b, false );
+        break;
+    }
+}
+
+void AABBTree::markMoved( int32_t proxy )
+{
+    if ( !m_Nodes[proxy].moved )
+    {
+        m_Nodes[proxy].moved = true;
+        m_Moved.push_back( proxy );
+    }
+}
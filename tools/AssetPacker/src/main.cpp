@@ -0,0 +1,311 @@
+// Packs images, sprite sheets, fonts, audio and other files into a single asset pack that can be
+// memory-mapped by Graphics::ResourceManager::mountPack.
+//
+// Usage: AssetPacker <manifest> <output pack>
+//
+// Each line of the manifest adds an asset to the pack:
+//
+//   # Comments start with '#'. Paths that contain spaces must be quoted.
+//   image "assets/Map.png"
+//   sheet "assets/Spirit Boxer/Idle.png" 137 44 [padding] [margin]
+//   font  "assets/fonts/Roboto.ttf"
+//   audio "assets/sounds/8-bit-powerup.mp3"
+//   data  "assets/Map.ldtk"
+//
+// Paths are stored as they are written in the manifest (after normalization), so they must match the paths
+// that the game uses to load the assets. Run the packer from the same directory that the game runs in.
+
+#include <Graphics/AssetPack.hpp>
+#include <Graphics/Color.hpp>
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Graphics;
+namespace fs = std::filesystem;
+
+namespace
+{
+// An asset that will be written to the pack.
+struct Asset
+{
+    std::string            path;  // The normalized path.
+    uint64_t               id;
+    AssetType              type;
+    std::vector<std::byte> data;
+    uint32_t               width  = 0u;
+    uint32_t               height = 0u;
+};
+
+class Packer
+{
+public:
+    bool addImage( const fs::path& path );
+    bool addSpriteSheet( const fs::path& path, uint32_t spriteWidth, uint32_t spriteHeight, uint32_t padding, uint32_t margin );
+    bool addFile( const fs::path& path, AssetType type );
+
+    bool write( const fs::path& packFile );
+
+private:
+    // Add an asset, unless an asset with the same path and type was already added.
+    Asset* add( const fs::path& path, AssetType type );
+
+    std::map<std::pair<uint64_t, AssetType>, Asset> assets;  // Sorted the same way as the index of the pack.
+};
+
+Asset* Packer::add( const fs::path& path, AssetType type )
+{
+    const std::string normalized = path.lexically_normal().generic_string();
+    const uint64_t    id         = AssetPack::hashPath( path );
+
+    auto [iter, inserted] = assets.try_emplace( { id, type } );
+    if ( !inserted )
+    {
+        if ( iter->second.path != normalized )
+            std::cerr << "ERROR: " << normalized << " has the same ID as " << iter->second.path << std::endl;
+        return nullptr;
+    }
+
+    iter->second.path = normalized;
+    iter->second.id   = id;
+    iter->second.type = type;
+
+    return &iter->second;
+}
+
+bool Packer::addImage( const fs::path& path )
+{
+    if ( assets.contains( { AssetPack::hashPath( path ), AssetType::Image } ) )
+        return true;
+
+    int      width, height, n;
+    stbi_uc* pixels = stbi_load( path.string().c_str(), &width, &height, &n, STBI_rgb_alpha );
+    if ( !pixels )
+    {
+        std::cerr << "ERROR: Could not load image: " << path.string() << " (" << stbi_failure_reason() << ")" << std::endl;
+        return false;
+    }
+
+    Asset* asset = add( path, AssetType::Image );
+    if ( !asset )
+    {
+        stbi_image_free( pixels );
+        return false;
+    }
+
+    asset->width  = static_cast<uint32_t>( width );
+    asset->height = static_cast<uint32_t>( height );
+    asset->data.resize( static_cast<size_t>( width ) * height * sizeof( Color ) );
+
+    // Store the pixels in the same order as Color (BGRA), so images can be used without being converted when they are loaded.
+    const stbi_uc* src = pixels;
+    auto*          dst = reinterpret_cast<uint8_t*>( asset->data.data() );
+    for ( size_t i = 0; i < static_cast<size_t>( width ) * height; ++i, src += 4, dst += 4 )
+    {
+        dst[0] = src[2];
+        dst[1] = src[1];
+        dst[2] = src[0];
+        dst[3] = src[3];
+    }
+
+    stbi_image_free( pixels );
+
+    return true;
+}
+
+bool Packer::addSpriteSheet( const fs::path& path, uint32_t spriteWidth, uint32_t spriteHeight, uint32_t padding, uint32_t margin )
+{
+    if ( !addImage( path ) )
+        return false;
+
+    Asset* asset = add( path, AssetType::SpriteSheet );
+    if ( !asset )
+        return false;
+
+    const AssetPack::SpriteSheetInfo info { AssetPack::hashPath( path ), spriteWidth, spriteHeight, padding, margin };
+
+    asset->data.resize( sizeof( info ) );
+    std::memcpy( asset->data.data(), &info, sizeof( info ) );
+
+    return true;
+}
+
+bool Packer::addFile( const fs::path& path, AssetType type )
+{
+    std::ifstream file { path, std::ios::binary };
+    if ( !file )
+    {
+        std::cerr << "ERROR: Could not open file: " << path.string() << std::endl;
+        return false;
+    }
+
+    Asset* asset = add( path, type );
+    if ( !asset )
+        return false;
+
+    asset->data.resize( fs::file_size( path ) );
+    file.read( reinterpret_cast<char*>( asset->data.data() ), static_cast<std::streamsize>( asset->data.size() ) );
+
+    return static_cast<bool>( file );
+}
+
+bool Packer::write( const fs::path& packFile )
+{
+    std::ofstream file { packFile, std::ios::binary };
+    if ( !file )
+    {
+        std::cerr << "ERROR: Could not create file: " << packFile.string() << std::endl;
+        return false;
+    }
+
+    auto alignTo = [&file]( uint64_t alignment ) {
+        static constexpr char zeros[AssetPack::DataAlignment] {};
+
+        const uint64_t pos = static_cast<uint64_t>( file.tellp() );
+        file.write( zeros, static_cast<std::streamsize>( ( alignment - pos % alignment ) % alignment ) );
+
+        return pos + ( alignment - pos % alignment ) % alignment;
+    };
+
+    AssetPack::Header header {};
+    header.magic      = AssetPack::Magic;
+    header.version    = AssetPack::Version;
+    header.numEntries = static_cast<uint32_t>( assets.size() );
+
+    // The header is written again when the offsets are known.
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+    std::vector<AssetPack::Entry> index;
+    std::string                   strings;
+    index.reserve( assets.size() );
+
+    for ( const auto& asset: assets | std::views::values )
+    {
+        AssetPack::Entry entry {};
+        entry.id          = asset.id;
+        entry.type        = asset.type;
+        entry.compression = AssetCompression::None;
+        entry.offset      = alignTo( AssetPack::DataAlignment );
+        entry.size        = asset.data.size();
+        entry.rawSize     = asset.data.size();
+        entry.width       = asset.width;
+        entry.height      = asset.height;
+        entry.pathOffset  = static_cast<uint32_t>( strings.size() );
+        entry.pathLength  = static_cast<uint32_t>( asset.path.size() );
+
+        file.write( reinterpret_cast<const char*>( asset.data.data() ), static_cast<std::streamsize>( asset.data.size() ) );
+        strings += asset.path;
+        index.push_back( entry );
+    }
+
+    header.indexOffset = alignTo( alignof( AssetPack::Entry ) );
+    file.write( reinterpret_cast<const char*>( index.data() ), static_cast<std::streamsize>( index.size() * sizeof( AssetPack::Entry ) ) );
+
+    header.stringsOffset = static_cast<uint64_t>( file.tellp() );
+    header.stringsSize   = strings.size();
+    file.write( strings.data(), static_cast<std::streamsize>( strings.size() ) );
+
+    const uint64_t fileSize = static_cast<uint64_t>( file.tellp() );
+
+    file.seekp( 0 );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+    if ( !file )
+    {
+        std::cerr << "ERROR: Failed to write file: " << packFile.string() << std::endl;
+        return false;
+    }
+
+    std::cout << "Packed " << assets.size() << " assets into " << packFile.string() << " (" << std::fixed << std::setprecision( 2 ) << static_cast<double>( fileSize ) / ( 1024.0 * 1024.0 ) << " MiB)" << std::endl;
+
+    return true;
+}
+}  // namespace
+
+int main( int argc, char* argv[] )
+{
+    if ( argc != 3 )
+    {
+        std::cerr << "Usage: AssetPacker <manifest> <output pack>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream manifest { argv[1] };
+    if ( !manifest )
+    {
+        std::cerr << "ERROR: Could not open manifest: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    Packer      packer;
+    bool        success = true;
+    std::string line;
+    for ( int lineNumber = 1; std::getline( manifest, line ); ++lineNumber )
+    {
+        std::istringstream stream { line };
+        std::string        type;
+        std::string        path;
+
+        if ( !( stream >> type ) || type.starts_with( '#' ) )
+            continue;
+
+        if ( !( stream >> std::quoted( path ) ) )
+        {
+            std::cerr << argv[1] << "(" << lineNumber << "): ERROR: Expected a path." << std::endl;
+            success = false;
+            continue;
+        }
+
+        if ( type == "image" )
+        {
+            success &= packer.addImage( path );
+        }
+        else if ( type == "sheet" )
+        {
+            uint32_t spriteWidth = 0u, spriteHeight = 0u, padding = 0u, margin = 0u;
+            if ( !( stream >> spriteWidth >> spriteHeight ) || spriteWidth == 0u || spriteHeight == 0u )
+            {
+                std::cerr << argv[1] << "(" << lineNumber << "): ERROR: Expected the sprite width and height." << std::endl;
+                success = false;
+                continue;
+            }
+
+            stream >> padding >> margin;
+
+            success &= packer.addSpriteSheet( path, spriteWidth, spriteHeight, padding, margin );
+        }
+        else if ( type == "font" )
+        {
+            success &= packer.addFile( path, AssetType::Font );
+        }
+        else if ( type == "audio" )
+        {
+            success &= packer.addFile( path, AssetType::Audio );
+        }
+        else if ( type == "data" )
+        {
+            success &= packer.addFile( path, AssetType::Data );
+        }
+        else
+        {
+            std::cerr << argv[1] << "(" << lineNumber << "): ERROR: Unknown asset type: " << type << std::endl;
+            success = false;
+        }
+    }
+
+    if ( !success )
+        return 1;
+
+    return packer.write( argv[2] ) ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+// Compiles an LDtk project into a binary level file (.lvl) that can be loaded by the game without parsing JSON
+// (see Game/inc/LevelFile.hpp).
+//
+// Usage: LevelCompiler <project.ldtk> <output.lvl> [--benchmark]
+//
+// For every level in every world of the project:
+//   * Tile layers (and auto-layers) are stored as dense grids of tile IDs (-1 for an empty cell).
+//   * "RectRegion" entities are stored as colliders.
+//   * All other entities are stored as spawn points (name, position, and size).
+//
+// Tileset paths are stored relative to the output file, so the .lvl file should be written next to the assets
+// that it uses (for example, next to the .ldtk file).
+//
+// With --benchmark, the time it takes to load the level data from the JSON project and from the compiled file is
+// measured and printed.
+
+#include <LevelFile.hpp>
+
+#include <LDtkLoader/Project.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+class Compiler
+{
+public:
+    explicit Compiler( const fs::path& outputDirectory )
+    : outputDirectory { fs::absolute( outputDirectory ).lexically_normal() }
+    {}
+
+    void addLevel( const fs::path& projectDirectory, const ldtk::Level& level );
+
+    bool write( const fs::path& levelFile ) const;
+
+private:
+    LevelFile::StringRef addString( std::string_view str );
+    uint32_t             addTileset( const fs::path& projectDirectory, const ldtk::Tileset& tileset );
+
+    fs::path outputDirectory;
+
+    std::vector<LevelFile::Level>    levels;
+    std::vector<LevelFile::Tileset>  tilesets;
+    std::vector<LevelFile::Layer>    layers;
+    std::vector<LevelFile::Collider> colliders;
+    std::vector<LevelFile::Entity>   entities;
+    std::vector<std::vector<int>>    tiles;  // The tile grid of each layer.
+    std::string                      strings;
+
+    std::map<int, uint32_t> tilesetIndices;  // LDtk tileset UID -> index in the tileset table.
+};
+
+LevelFile::StringRef Compiler::addString( std::string_view str )
+{
+    const LevelFile::StringRef ref { static_cast<uint32_t>( strings.size() ), static_cast<uint32_t>( str.size() ) };
+    strings += str;
+
+    return ref;
+}
+
+uint32_t Compiler::addTileset( const fs::path& projectDirectory, const ldtk::Tileset& tileset )
+{
+    if ( auto iter = tilesetIndices.find( tileset.uid ); iter != tilesetIndices.end() )
+        return iter->second;
+
+    const fs::path path = fs::absolute( projectDirectory / tileset.path ).lexically_normal().lexically_relative( outputDirectory );
+
+    LevelFile::Tileset info {};
+    info.path     = addString( path.generic_string() );
+    info.tileSize = static_cast<uint32_t>( tileset.tile_size );
+    info.padding  = static_cast<uint32_t>( tileset.padding );
+    info.spacing  = static_cast<uint32_t>( tileset.spacing );
+
+    const auto index = static_cast<uint32_t>( tilesets.size() );
+    tilesets.push_back( info );
+    tilesetIndices.emplace( tileset.uid, index );
+
+    return index;
+}
+
+void Compiler::addLevel( const fs::path& projectDirectory, const ldtk::Level& level )
+{
+    LevelFile::Level info {};
+    info.name          = addString( level.name );
+    info.worldX        = level.position.x;
+    info.worldY        = level.position.y;
+    info.width         = static_cast<uint32_t>( level.size.x );
+    info.height        = static_cast<uint32_t>( level.size.y );
+    info.firstLayer    = static_cast<uint32_t>( layers.size() );
+    info.firstCollider = static_cast<uint32_t>( colliders.size() );
+    info.firstEntity   = static_cast<uint32_t>( entities.size() );
+
+    for ( const auto& layer: level.allLayers() )
+    {
+        if ( layer.getType() == ldtk::LayerType::Entities )
+        {
+            for ( const auto& entity: layer.allEntities() )
+            {
+                const auto& p = entity.getPosition();
+                const auto& s = entity.getSize();
+
+                if ( entity.getName() == "RectRegion" )
+                {
+                    // The same bounds that the level uses when it is loaded from the LDtk project.
+                    LevelFile::Collider collider {};
+                    collider.minX = static_cast<float>( p.x );
+                    collider.minY = static_cast<float>( p.y );
+                    collider.maxX = static_cast<float>( p.x + s.x - 1 );
+                    collider.maxY = static_cast<float>( p.y + s.y - 1 );
+
+                    colliders.push_back( collider );
+                }
+                else
+                {
+                    LevelFile::Entity spawn {};
+                    spawn.name   = addString( entity.getName() );
+                    spawn.x      = static_cast<float>( p.x );
+                    spawn.y      = static_cast<float>( p.y );
+                    spawn.width  = static_cast<float>( s.x );
+                    spawn.height = static_cast<float>( s.y );
+
+                    entities.push_back( spawn );
+                }
+            }
+        }
+        else if ( layer.hasTileset() )
+        {
+            const auto& gridSize = layer.getGridSize();
+
+            LevelFile::Layer layerInfo {};
+            layerInfo.name     = addString( layer.getName() );
+            layerInfo.tileset  = addTileset( projectDirectory, layer.getTileset() );
+            layerInfo.columns  = static_cast<uint32_t>( gridSize.x );
+            layerInfo.rows     = static_cast<uint32_t>( gridSize.y );
+            layerInfo.gridSize = static_cast<uint32_t>( layer.getCellSize() );
+
+            auto& grid = tiles.emplace_back( static_cast<size_t>( gridSize.x ) * gridSize.y, -1 );
+            for ( const auto& tile: layer.allTiles() )
+            {
+                const auto& gridPos = tile.getGridPosition();
+                if ( gridPos.x >= 0 && gridPos.x < gridSize.x && gridPos.y >= 0 && gridPos.y < gridSize.y )
+                    grid[static_cast<size_t>( gridPos.y ) * gridSize.x + gridPos.x] = tile.tileId;
+            }
+
+            layers.push_back( layerInfo );
+        }
+    }
+
+    info.numLayers    = static_cast<uint32_t>( layers.size() ) - info.firstLayer;
+    info.numColliders = static_cast<uint32_t>( colliders.size() ) - info.firstCollider;
+    info.numEntities  = static_cast<uint32_t>( entities.size() ) - info.firstEntity;
+
+    levels.push_back( info );
+}
+
+bool Compiler::write( const fs::path& levelFile ) const
+{
+    std::ofstream file { levelFile, std::ios::binary };
+    if ( !file )
+    {
+        std::cerr << "ERROR: Could not create file: " << levelFile.string() << std::endl;
+        return false;
+    }
+
+    auto alignTo = [&file]( uint64_t alignment ) {
+        static constexpr char zeros[LevelFile::DataAlignment] {};
+
+        const uint64_t pos = static_cast<uint64_t>( file.tellp() );
+        file.write( zeros, static_cast<std::streamsize>( ( alignment - pos % alignment ) % alignment ) );
+
+        return pos + ( alignment - pos % alignment ) % alignment;
+    };
+
+    auto writeArray = [&file, &alignTo]( const auto& array ) {
+        const uint64_t offset = alignTo( LevelFile::DataAlignment );
+        file.write( reinterpret_cast<const char*>( array.data() ), static_cast<std::streamsize>( array.size() * sizeof( array[0] ) ) );
+
+        return offset;
+    };
+
+    LevelFile::Header header {};
+    header.magic        = LevelFile::Magic;
+    header.version      = LevelFile::Version;
+    header.numLevels    = static_cast<uint32_t>( levels.size() );
+    header.numTilesets  = static_cast<uint32_t>( tilesets.size() );
+    header.numLayers    = static_cast<uint32_t>( layers.size() );
+    header.numColliders = static_cast<uint32_t>( colliders.size() );
+    header.numEntities  = static_cast<uint32_t>( entities.size() );
+    header.stringsSize  = static_cast<uint32_t>( strings.size() );
+
+    // The header is written again when the offsets are known.
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+    // The tile grids are written first, so the layer records can point to them.
+    std::vector<LevelFile::Layer> layerRecords = layers;
+    for ( size_t i = 0; i < layerRecords.size(); ++i )
+        layerRecords[i].tilesOffset = writeArray( tiles[i] );
+
+    header.levelsOffset    = writeArray( levels );
+    header.tilesetsOffset  = writeArray( tilesets );
+    header.layersOffset    = writeArray( layerRecords );
+    header.collidersOffset = writeArray( colliders );
+    header.entitiesOffset  = writeArray( entities );
+    header.stringsOffset   = writeArray( strings );
+
+    const uint64_t fileSize = static_cast<uint64_t>( file.tellp() );
+
+    file.seekp( 0 );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+    if ( !file )
+    {
+        std::cerr << "ERROR: Failed to write file: " << levelFile.string() << std::endl;
+        return false;
+    }
+
+    std::cout << "Compiled " << levels.size() << " levels (" << layers.size() << " layers, " << colliders.size() << " colliders, " << entities.size() << " entities) into " << levelFile.string() << " (" << fileSize / 1024 << " KiB)" << std::endl;
+
+    return true;
+}
+
+// Measure the average time it takes to run a function (in milliseconds).
+template<typename Func>
+double measure( int iterations, Func&& func )
+{
+    const auto start = std::chrono::high_resolution_clock::now();
+    for ( int i = 0; i < iterations; ++i )
+        func();
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::milli>( end - start ).count() / iterations;
+}
+
+// Compare loading the level data (tile grids and colliders) from the LDtk project with loading it from the compiled file.
+// Sprite sheets are not loaded, since they are the same for both paths.
+void benchmark( const fs::path& projectFile, const fs::path& levelFile )
+{
+    constexpr int Iterations = 20;
+
+    size_t checksum = 0u;
+
+    const double jsonTime = measure( Iterations, [&] {
+        ldtk::Project project;
+        project.loadFromFile( projectFile.string() );
+
+        for ( const auto& world: project.allWorlds() )
+        {
+            for ( const auto& level: world.allLevels() )
+            {
+                for ( const auto& layer: level.allLayers() )
+                {
+                    if ( layer.getType() == ldtk::LayerType::Entities )
+                    {
+                        std::vector<LevelFile::Collider> levelColliders;
+                        for ( const auto& entity: layer.getEntitiesByName( "RectRegion" ) )
+                        {
+                            const auto& p = entity.get().getPosition();
+                            const auto& s = entity.get().getSize();
+                            levelColliders.push_back( { static_cast<float>( p.x ), static_cast<float>( p.y ), static_cast<float>( p.x + s.x - 1 ), static_cast<float>( p.y + s.y - 1 ), 0u, 0u } );
+                        }
+                        checksum += levelColliders.size();
+                    }
+                    else if ( layer.hasTileset() )
+                    {
+                        const auto&      gridSize = layer.getGridSize();
+                        std::vector<int> grid( static_cast<size_t>( gridSize.x ) * gridSize.y, -1 );
+                        for ( const auto& tile: layer.allTiles() )
+                        {
+                            const auto& gridPos = tile.getGridPosition();
+                            grid[static_cast<size_t>( gridPos.y ) * gridSize.x + gridPos.x] = tile.tileId;
+                        }
+                        checksum += grid.size();
+                    }
+                }
+            }
+        }
+    } );
+
+    const double binaryTime = measure( Iterations, [&] {
+        const LevelFile file { levelFile };
+
+        for ( const auto& level: file.getLevels() )
+        {
+            const auto                             fileColliders = file.getColliders( level );
+            const std::vector<LevelFile::Collider> levelColliders( fileColliders.begin(), fileColliders.end() );
+            checksum += levelColliders.size();
+
+            for ( const auto& layer: file.getLayers( level ) )
+            {
+                const auto             layerTiles = file.getTiles( layer );
+                const std::vector<int> grid( layerTiles.begin(), layerTiles.end() );
+                checksum += grid.size();
+            }
+        }
+    } );
+
+    std::cout << "Average load time over " << Iterations << " iterations (checksum " << checksum << "):\n"
+              << "  JSON (" << projectFile.string() << "): " << jsonTime << " ms\n"
+              << "  Binary (" << levelFile.string() << "): " << binaryTime << " ms\n"
+              << "  Speedup: " << jsonTime / binaryTime << "x" << std::endl;
+}
+}  // namespace
+
+int main( int argc, char* argv[] )
+{
+    if ( argc < 3 || argc > 4 || ( argc == 4 && std::strcmp( argv[3], "--benchmark" ) != 0 ) )
+    {
+        std::cerr << "Usage: LevelCompiler <project.ldtk> <output.lvl> [--benchmark]" << std::endl;
+        return 1;
+    }
+
+    const fs::path projectFile = argv[1];
+    const fs::path levelFile   = argv[2];
+
+    ldtk::Project project;
+    try
+    {
+        project.loadFromFile( projectFile.string() );
+    }
+    catch ( const std::exception& e )
+    {
+        std::cerr << "ERROR: Could not load LDtk project: " << projectFile.string() << " (" << e.what() << ")" << std::endl;
+        return 1;
+    }
+
+    const fs::path projectDirectory = projectFile.parent_path();
+
+    Compiler compiler { levelFile.parent_path() };
+    for ( const auto& world: project.allWorlds() )
+    {
+        for ( const auto& level: world.allLevels() )
+            compiler.addLevel( projectDirectory, level );
+    }
+
+    if ( !compiler.write( levelFile ) )
+        return 1;
+
+    if ( argc == 4 )
+        benchmark( projectFile, levelFile );
+
+    return 0;
+}